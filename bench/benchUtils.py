@@ -0,0 +1,67 @@
+#
+# LSST Data Management System
+#
+# Copyright 2008-2016  AURA/LSST.
+#
+# This product includes software developed by the
+# LSST Project (http://www.lsst.org/).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the LSST License Statement and
+# the GNU General Public License along with this program.  If not,
+# see <https://www.lsstcorp.org/LegalNotices/>.
+#
+"""Shared timing helpers for the scripts in bench/."""
+
+import time
+
+__all__ = ("benchmark",)
+
+
+def _formatTime(seconds):
+    for unit, factor in (("s ", 1.0), ("ms", 1e3), ("us", 1e6)):
+        value = seconds*factor
+        if value >= 1.0:
+            return f"{value:9.3f} {unit}"
+    return f"{seconds*1e9:9.3f} ns"
+
+
+def benchmark(name, func, repeat=5, minTime=0.2):
+    """Time ``func()`` and print a one-line report.
+
+    The function is called repeatedly until at least ``minTime`` seconds have
+    elapsed to amortize timer resolution, that measurement is repeated
+    ``repeat`` times, and the best per-call time is reported (the minimum is
+    the least noisy estimator on a shared machine).
+
+    Returns the best per-call time in seconds, so scripts can derive their
+    own throughput numbers from it.
+    """
+    func()  # warm up (and fail fast if the case is broken)
+    number = 1
+    while True:
+        begin = time.perf_counter()
+        for _ in range(number):
+            func()
+        elapsed = time.perf_counter() - begin
+        if elapsed >= minTime:
+            break
+        number = max(number + 1, int(number*minTime/max(elapsed, 1e-9)))
+    best = elapsed/number
+    for _ in range(repeat - 1):
+        begin = time.perf_counter()
+        for _ in range(number):
+            func()
+        elapsed = time.perf_counter() - begin
+        best = min(best, elapsed/number)
+    print(f"{name:56s} {_formatTime(best)}/call  ({number} calls x {repeat} reps)")
+    return best
@@ -0,0 +1,82 @@
+#
+# LSST Data Management System
+#
+# Copyright 2008-2016  AURA/LSST.
+#
+# This product includes software developed by the
+# LSST Project (http://www.lsst.org/).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the LSST License Statement and
+# the GNU General Public License along with this program.  If not,
+# see <https://www.lsstcorp.org/LegalNotices/>.
+#
+"""Benchmark for a full CModelAlgorithm.apply() on synthetic data: a single
+noiseless point source on a postage stamp (the same setup as test_cModel.py)."""
+
+import numpy
+
+import lsst.afw.detection
+import lsst.afw.geom
+import lsst.afw.image
+import lsst.geom
+import lsst.shapelet
+import lsst.meas.modelfit
+
+from benchUtils import benchmark
+
+
+def makeMultiShapeletCircularGaussian(sigma):
+    s = lsst.shapelet.ShapeletFunction(0, lsst.shapelet.HERMITE, sigma)
+    s.getCoefficients()[0] = 1.0 / lsst.shapelet.ShapeletFunction.FLUX_FACTOR
+    m = lsst.shapelet.MultiShapeletFunction()
+    m.addComponent(s)
+    return m
+
+
+def makeExposure(psfSigma, trueFlux, xyPosition):
+    crval = lsst.geom.SpherePoint(45.0, 45.0, lsst.geom.degrees)
+    scale = 0.2*lsst.geom.arcseconds
+    wcs = lsst.afw.geom.makeSkyWcs(crpix=lsst.geom.Point2D(0.0, 0.0), crval=crval,
+                                   cdMatrix=lsst.afw.geom.makeCdMatrix(scale=scale, flipX=True))
+    bbox = lsst.geom.Box2I(lsst.geom.Point2I(-100, -100), lsst.geom.Point2I(100, 100))
+    exposure = lsst.afw.image.ExposureF(bbox)
+    exposure.setWcs(wcs)
+    exposure.setPhotoCalib(lsst.afw.image.PhotoCalib(4.0))
+    psf = lsst.afw.detection.GaussianPsf(25, 25, psfSigma)
+    exposure.setPsf(psf)
+    psfImage = psf.computeImage(xyPosition)
+    psfImage.getArray()[:, :] *= trueFlux
+    subImage = lsst.afw.image.ImageF(exposure.getMaskedImage().getImage(),
+                                     psfImage.getBBox(lsst.afw.image.PARENT),
+                                     lsst.afw.image.PARENT)
+    subImage.getArray()[:, :] = psfImage.getArray()
+    exposure.getMaskedImage().getVariance().getArray()[:, :] = 1E-16
+    return exposure
+
+
+def main():
+    numpy.random.seed(500)
+    psfSigma = 2.0
+    xyPosition = lsst.geom.Point2D(1.1, -0.8)
+    exposure = makeExposure(psfSigma, 65.0, xyPosition)
+    ctrl = lsst.meas.modelfit.CModelControl()
+    ctrl.initial.usePixelWeights = False
+    algorithm = lsst.meas.modelfit.CModelAlgorithm(ctrl)
+    psf = makeMultiShapeletCircularGaussian(psfSigma)
+    moments = exposure.getPsf().computeShape(exposure.getPsf().getAveragePosition())
+    benchmark("CModelAlgorithm.apply (point source, 201x201 stamp)",
+              lambda: algorithm.apply(exposure, psf, xyPosition, moments))
+
+
+if __name__ == "__main__":
+    main()
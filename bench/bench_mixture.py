@@ -0,0 +1,57 @@
+#
+# LSST Data Management System
+#
+# Copyright 2008-2016  AURA/LSST.
+#
+# This product includes software developed by the
+# LSST Project (http://www.lsst.org/).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the LSST License Statement and
+# the GNU General Public License along with this program.  If not,
+# see <https://www.lsstcorp.org/LegalNotices/>.
+#
+"""Benchmarks for Mixture.evaluate and Mixture.updateEM."""
+
+import numpy
+
+import lsst.meas.modelfit
+
+from benchUtils import benchmark
+
+
+def makeRandomMixture(nDim, nComponents, df=float("inf")):
+    componentList = []
+    for i in range(nComponents):
+        mu = numpy.random.randn(nDim)*4
+        a = numpy.random.randn(nDim+1, nDim)
+        sigma = numpy.dot(a.transpose(), a) + numpy.identity(nDim)
+        componentList.append(lsst.meas.modelfit.Mixture.Component(numpy.random.rand(), mu, sigma))
+    return lsst.meas.modelfit.Mixture(nDim, componentList, df)
+
+
+def main():
+    numpy.random.seed(500)
+    for nDim, nComponents in ((2, 3), (3, 8)):
+        mixture = makeRandomMixture(nDim, nComponents)
+        for nSamples in (10**3, 10**4, 10**5):
+            x = numpy.random.randn(nSamples, nDim)*4
+            p = numpy.zeros(nSamples, dtype=lsst.meas.modelfit.Scalar)
+            benchmark(f"Mixture.evaluate dim={nDim} K={nComponents} n={nSamples}",
+                      lambda: mixture.evaluate(x, p))
+            w = numpy.ones(nSamples, dtype=lsst.meas.modelfit.Scalar)
+            benchmark(f"Mixture.updateEM dim={nDim} K={nComponents} n={nSamples}",
+                      lambda: mixture.updateEM(x, w))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,60 @@
+#
+# LSST Data Management System
+#
+# Copyright 2008-2016  AURA/LSST.
+#
+# This product includes software developed by the
+# LSST Project (http://www.lsst.org/).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the LSST License Statement and
+# the GNU General Public License along with this program.  If not,
+# see <https://www.lsstcorp.org/LegalNotices/>.
+#
+"""Benchmarks for solveTrustRegion and the stateful TrustRegionSolver."""
+
+import numpy
+
+import lsst.meas.modelfit
+
+from benchUtils import benchmark
+
+
+def makeProblem(nDim):
+    a = numpy.random.randn(nDim + 1, nDim)
+    hessian = numpy.dot(a.transpose(), a)
+    gradient = numpy.random.randn(nDim)
+    return hessian, gradient
+
+
+def main():
+    numpy.random.seed(500)
+    tolerance = 1E-8
+    for nDim in (3, 8, 20):
+        hessian, gradient = makeProblem(nDim)
+        step = numpy.zeros(nDim, dtype=lsst.meas.modelfit.Scalar)
+        benchmark(f"solveTrustRegion dim={nDim}",
+                  lambda: lsst.meas.modelfit.solveTrustRegion(step, hessian, gradient, 0.1, tolerance))
+        solver = lsst.meas.modelfit.TrustRegionSolver()
+        solver.setProblem(hessian, gradient)
+
+        def runSolver():
+            # shrinking radii mimic the rejected-step inner loop of the optimizer,
+            # which is where the cached eigendecomposition pays off
+            for radius in (0.5, 0.2, 0.1):
+                solver.solve(step, radius, tolerance)
+
+        benchmark(f"TrustRegionSolver.solve x3 dim={nDim}", runSolver)
+
+
+if __name__ == "__main__":
+    main()
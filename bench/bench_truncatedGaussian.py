@@ -0,0 +1,54 @@
+#
+# LSST Data Management System
+#
+# Copyright 2008-2016  AURA/LSST.
+#
+# This product includes software developed by the
+# LSST Project (http://www.lsst.org/).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the LSST License Statement and
+# the GNU General Public License along with this program.  If not,
+# see <https://www.lsstcorp.org/LegalNotices/>.
+#
+"""Benchmarks for TruncatedGaussian sampling."""
+
+import numpy
+
+import lsst.afw.math
+import lsst.meas.modelfit
+
+from benchUtils import benchmark
+
+STRATEGIES = {
+    "DWR": lsst.meas.modelfit.TruncatedGaussian.DIRECT_WITH_REJECTION,
+    "AAW": lsst.meas.modelfit.TruncatedGaussian.ALIGN_AND_WEIGHT,
+}
+
+
+def main():
+    rng = lsst.afw.math.Random(1)
+    mu = numpy.array([1.0, 0.5])
+    sigma = numpy.array([[1.0, 0.2],
+                         [0.2, 0.8]])
+    tg = lsst.meas.modelfit.TruncatedGaussian.fromStandardParameters(mu, sigma)
+    for name, strategy in STRATEGIES.items():
+        sampler = tg.sample(strategy)
+        for nSamples in (10**2, 10**3, 10**4):
+            alpha = numpy.zeros((nSamples, 2), dtype=lsst.meas.modelfit.Scalar)
+            weights = numpy.zeros(nSamples, dtype=lsst.meas.modelfit.Scalar)
+            benchmark(f"TruncatedGaussian.sample {name} n={nSamples}",
+                      lambda: sampler(rng, alpha, weights))
+
+
+if __name__ == "__main__":
+    main()
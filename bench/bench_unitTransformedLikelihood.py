@@ -0,0 +1,86 @@
+#
+# LSST Data Management System
+#
+# Copyright 2008-2016  AURA/LSST.
+#
+# This product includes software developed by the
+# LSST Project (http://www.lsst.org/).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the LSST License Statement and
+# the GNU General Public License along with this program.  If not,
+# see <https://www.lsstcorp.org/LegalNotices/>.
+#
+"""Benchmarks for UnitTransformedLikelihood.computeModelMatrix over a range
+of footprint sizes (10^2 to 10^5 pixels)."""
+
+import numpy
+
+import lsst.afw.detection
+import lsst.afw.geom
+import lsst.afw.image
+import lsst.geom
+import lsst.shapelet
+import lsst.meas.modelfit
+
+from benchUtils import benchmark
+
+
+def makeGaussianFunction(sigma):
+    s = lsst.shapelet.ShapeletFunction(0, lsst.shapelet.HERMITE, sigma)
+    s.getCoefficients()[0] = 1.0
+    s.normalize()
+    msf = lsst.shapelet.MultiShapeletFunction()
+    msf.addComponent(s)
+    return msf
+
+
+def makeLikelihood(model, fixed, position, halfSize):
+    scale = 0.2*lsst.geom.arcseconds
+    wcs = lsst.afw.geom.makeSkyWcs(crpix=lsst.geom.Point2D(0, 0), crval=position,
+                                   cdMatrix=lsst.afw.geom.makeCdMatrix(scale=scale))
+    bbox = lsst.geom.Box2I(lsst.geom.Point2I(-halfSize, -halfSize),
+                           lsst.geom.Point2I(halfSize, halfSize))
+    exposure = lsst.afw.image.ExposureF(bbox)
+    exposure.setWcs(wcs)
+    exposure.setPhotoCalib(lsst.afw.image.PhotoCalib(10))
+    exposure.getMaskedImage().getVariance().set(1.0)
+    footprint = lsst.afw.detection.Footprint(lsst.afw.geom.SpanSet(bbox))
+    fitSys = lsst.meas.modelfit.UnitSystem(exposure)
+    ctrl = lsst.meas.modelfit.UnitTransformedLikelihoodControl()
+    return lsst.meas.modelfit.UnitTransformedLikelihood(
+        model, fixed, fitSys, position, exposure, footprint, makeGaussianFunction(2.0), ctrl
+    )
+
+
+def main():
+    numpy.random.seed(500)
+    position = lsst.geom.SpherePoint(45.0, 45.0, lsst.geom.degrees)
+    model = lsst.meas.modelfit.Model.makeGaussian(lsst.meas.modelfit.Model.FIXED_CENTER)
+    ellipse = lsst.afw.geom.ellipses.Ellipse(lsst.afw.geom.ellipses.Axes(6.0, 5.0, numpy.pi/6))
+    ev = model.makeEllipseVector()
+    ev[0].setCore(ellipse.getCore())
+    ev[0].setCenter(ellipse.getCenter())
+    nonlinear = numpy.zeros(model.getNonlinearDim(), dtype=lsst.meas.modelfit.Scalar)
+    fixed = numpy.zeros(model.getFixedDim(), dtype=lsst.meas.modelfit.Scalar)
+    model.readEllipses(ev, nonlinear, fixed)
+    # square footprints with ~10^2, 10^3, 10^4, and 10^5 pixels
+    for halfSize in (5, 16, 50, 158):
+        likelihood = makeLikelihood(model, fixed, position, halfSize)
+        matrix = numpy.zeros((likelihood.getAmplitudeDim(), likelihood.getDataDim()),
+                             dtype=lsst.meas.modelfit.Pixel).transpose()
+        benchmark(f"computeModelMatrix nPix={likelihood.getDataDim()}",
+                  lambda: likelihood.computeModelMatrix(matrix, nonlinear))
+
+
+if __name__ == "__main__":
+    main()
@@ -33,6 +33,8 @@
 
 namespace lsst { namespace meas { namespace modelfit {
 
+class SampleSetWriter;
+
 /**
  *  @brief Control object for one iteration of adaptive importance sampling
  *
@@ -54,9 +56,30 @@ public:
         maxRepeat, int,
         "Maximum number of times this iteration will be repeated to meet the perplexityTarget"
     );
+    LSST_CONTROL_FIELD(
+        targetEffectiveSampleSizeFraction, double,
+        "Minimum effective sample size after this iteration, as a fraction of the number of samples "
+        "drawn.  As with targetPerplexity, the iteration is repeated up to maxRepeat times until the "
+        "target is met, and skipped entirely if any previous iteration already meets it.  Zero (the "
+        "default) disables the test, leaving perplexity alone to control termination."
+    );
+    LSST_CONTROL_FIELD(
+        nThreads, int,
+        "Number of threads used to evaluate the objective over the drawn samples (1 = serial). "
+        "Values > 1 require the SamplingObjective's call operator to be safe to invoke "
+        "concurrently on distinct records."
+    );
+    LSST_CONTROL_FIELD(
+        nChains, int,
+        "Number of independent chains used to draw the samples (1 = single chain). "
+        "Each chain draws its share of nSamples from the proposal with its own random "
+        "number stream, and the chains are merged into a single sample catalog before "
+        "weights are computed and the proposal is updated."
+    );
 
     ImportanceSamplerControl() :
-        nSamples(2000), nUpdateSteps(2), tau1(1E-4), tau2(0.5), targetPerplexity(1.0), maxRepeat(0)
+        nSamples(2000), nUpdateSteps(2), tau1(1E-4), tau2(0.5), targetPerplexity(1.0), maxRepeat(0),
+        targetEffectiveSampleSizeFraction(0.0), nThreads(1), nChains(1)
     {}
 };
 
@@ -97,6 +120,19 @@ public:
 
     double computeEffectiveSampleSizeFraction(afw::table::BaseCatalog const & samples) const;
 
+    /**
+     *  @brief Attach a columnar sample-set writer (may be null to detach)
+     *
+     *  When a writer is attached, each call to run() appends its final sample
+     *  catalog to the writer as one block, tagged with a running block counter.
+     *  This provides an incremental, mmap-readable record of the samples
+     *  without serializing catalogs through FITS (see SampleSetWriter).
+     */
+    void setSampleWriter(std::shared_ptr<SampleSetWriter> writer) { _sampleWriter = writer; }
+
+    /// @brief Return the attached sample-set writer (may be null)
+    std::shared_ptr<SampleSetWriter> getSampleWriter() const { return _sampleWriter; }
+
 private:
     bool _doSaveIterations;
     std::shared_ptr<afw::math::Random>  _rng;
@@ -107,6 +143,7 @@ private:
     afw::table::Key< afw::table::Array<Scalar> > _parametersKey;
     afw::table::Key<int> _iterCtrlKey;
     afw::table::Key<int> _iterRepeatKey;
+    std::shared_ptr<SampleSetWriter> _sampleWriter;
 };
 
 }}} // namespace lsst::meas::modelfit
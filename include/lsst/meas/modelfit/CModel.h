@@ -25,7 +25,9 @@
 #define LSST_MEAS_MODELFIT_CModelFit_h_INCLUDED
 
 #include <bitset>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "ndarray.h"
 
@@ -235,7 +237,10 @@ struct CModelControl {
     CModelControl() :
         psfName("modelfit_DoubleShapeletPsfApprox"),
         minInitialRadius(0.1),
-        fallbackInitialMomentsPsfFactor(1.5)
+        fallbackInitialMomentsPsfFactor(1.5),
+        fastPathSNThreshold(0.0),
+        fastPathRadiusThreshold(2.0),
+        fastPathMaxOuterIterations(50)
     {
         initial.nComponents = 3; // use very rough model in initial fit
         initial.optimizer.gradientThreshold = 1E-3; // with slightly coarser convergence criteria
@@ -285,6 +290,26 @@ struct CModelControl {
         "  If <= 0.0, abort the fit early instead."
     );
 
+    LSST_CONTROL_FIELD(
+        fastPathSNThreshold, double,
+        "If > 0, sources whose initial-stage signal-to-noise is below this threshold and whose "
+        "initial determinant radius is below fastPathRadiusThreshold take a fast path: the exp "
+        "stage runs with its outer iteration count capped at fastPathMaxOuterIterations, and the "
+        "dev stage is replaced by an amplitude-only fit at the exp ellipse (the two stages land "
+        "on nearly identical ellipses near the detection limit).  0 disables the fast path."
+    );
+
+    LSST_CONTROL_FIELD(
+        fastPathRadiusThreshold, double,
+        "Maximum initial-stage determinant radius (in pixels) for a source to take the fast path; "
+        "only used when fastPathSNThreshold > 0."
+    );
+
+    LSST_CONTROL_FIELD(
+        fastPathMaxOuterIterations, int,
+        "Cap on the exp-stage optimizer's maxOuterIterations when a source takes the fast path."
+    );
+
 };
 
 /**
@@ -324,6 +349,13 @@ struct CModelStageResult {
     ndarray::Array<Scalar const,1,1> fixed;      ///< Opaque fixed parameters in specialized units
 
     afw::table::BaseCatalog history;  ///< Trace of the optimizer's path, if enabled by diagnostic options
+
+    /// Checkpoint of the optimizer's final state; may be fed back via CModelAlgorithm::apply's
+    /// warmStart argument to make a refit of the same source converge in a few steps.
+    /// Null for stages that did not run a nonlinear fit (e.g. forced mode or the faint-source
+    /// fast path's dev stage).
+    std::shared_ptr<OptimizerCheckpoint> checkpoint;
+
     std::bitset<N_FLAGS> flags; ///< Array of flags.
 };
 
@@ -380,6 +412,60 @@ struct CModelResult {
     std::bitset<N_FLAGS> flags; ///< Array of flags.
 };
 
+/**
+ *  Performance counters for one nonlinear stage of CModelAlgorithm.
+ *
+ *  Counters accumulate over all sources measured by an algorithm instance; see
+ *  CModelAlgorithm::getStats().
+ */
+struct CModelStageStats {
+
+    CModelStageStats() : fitCount(0), iterationCount(0), modelMatrixCount(0), time(0.0) {}
+
+    std::int64_t fitCount;         ///< Number of nonlinear fits run by this stage.
+    std::int64_t iterationCount;   ///< Total optimizer outer iterations over all fits.
+    std::int64_t modelMatrixCount; ///< Total model matrix evaluations over all fits.
+    Scalar time;                   ///< Accumulated wall-clock time in this stage's fits, in seconds.
+};
+
+/**
+ *  Performance counters for CModelAlgorithm, accumulated over all sources measured by an
+ *  algorithm instance.
+ *
+ *  The counters are cheap enough to leave enabled in production (a handful of integer
+ *  increments and clock reads per source); use them to tell which stage dominates the
+ *  runtime on a slow dataset without attaching a profiler.
+ */
+struct CModelStats {
+
+    CModelStats() : linearFitCount(0), linearTime(0.0), totalTime(0.0) {}
+
+    CModelStageStats initial;   ///< Counters for the initial approximate nonlinear fit.
+    CModelStageStats exp;       ///< Counters for the exponential fit.
+    CModelStageStats dev;       ///< Counters for the de Vaucouleur fit.
+    std::int64_t linearFitCount; ///< Number of final two-component linear fits.
+    Scalar linearTime;          ///< Accumulated wall-clock time in the final linear fit, in seconds.
+    Scalar totalTime;           ///< Accumulated wall-clock time over full per-source measurements.
+};
+
+/**
+ *  Profiling record for a single source measured by CModelAlgorithm::measure.
+ *
+ *  Unlike the always-on aggregate counters in CModelStats, per-source records are only
+ *  collected when profiling is explicitly enabled (see CModelAlgorithm::setProfilingEnabled);
+ *  they tell you *which* sources dominate a slow catalog, not just which stage.
+ */
+struct CModelSourceProfile {
+
+    CModelSourceProfile() : id(0), time(0.0), iterationCount(0), footprintArea(0) {}
+
+    std::int64_t id;             ///< ID of the measured SourceRecord.
+    Scalar time;                 ///< Wall-clock seconds spent measuring this source.
+    std::int64_t iterationCount; ///< Optimizer outer iterations summed over the three nonlinear stages.
+    int footprintArea;           ///< Area of the detection footprint, in pixels.
+    std::bitset<CModelResult::N_FLAGS> flags;  ///< Top-level result flags for this source.
+};
+
 /**
  *  Main public interface class for CModel algorithm.
  *
@@ -460,6 +546,12 @@ public:
      *                            estimating the region of pixel to include in the fit.
      *  @param[in]   footprintArea  Area of the detection Fooptrint; used as the fallback when
      *                              estimating the region of pixel to include in the fit.
+     *  @param[in]   warmStart    Result from a previous fit of the same source (with the same
+     *                            configuration), whose per-stage optimizer checkpoints will be
+     *                            used to warm-start the nonlinear fits.  Intended for
+     *                            reprocessing runs where only the calibrations have changed
+     *                            slightly; checkpoints whose parameter dimensions don't match
+     *                            the current models are ignored.
      */
     Result apply(
         afw::image::Exposure<Pixel> const & exposure,
@@ -468,7 +560,8 @@ public:
         afw::geom::ellipses::Quadrupole const & moments,
         Scalar approxFlux=-1,
         Scalar kronRadius=-1,
-        int footprintArea=-1
+        int footprintArea=-1,
+        Result const * warmStart=nullptr
     ) const;
 
     /**
@@ -529,6 +622,57 @@ public:
         afw::table::SourceRecord const & refRecord
     ) const;
 
+    /**
+     *  Run the CModel algorithm on all sources in a catalog, optionally in parallel.
+     *
+     *  This is equivalent to calling measure(record, exposure) on every record in the
+     *  catalog, but the loop runs in C++ and can be distributed over an internal pool
+     *  of worker threads, each with its own copy of the per-stage fitting state (the
+     *  schema keys are shared, as they are read-only during measurement).  Per-source
+     *  failures are handled the way the measurement framework plugin handles them:
+     *  the appropriate failure flags are set on the record and the loop continues.
+     *
+     *  When run with more than one thread, the sources flow through a two-stage
+     *  pipeline: a dedicated producer thread pre-extracts each source's initial fit
+     *  region pixel buffers (which is memory-latency bound) into a bounded queue,
+     *  while the worker threads pull from the queue and run the compute-bound fits,
+     *  so the two phases overlap instead of stalling each other.  The producer runs
+     *  in addition to the nThreads fit workers.
+     *
+     *  Results are buffered for the whole catalog and written out at the end in one
+     *  contiguous pass per output column (when the catalog is contiguous), rather
+     *  than field-by-field per record during the loop.
+     *
+     *  The performance counters (getStats()) and, when enabled, the per-source
+     *  profiling records accumulated by the worker threads are merged back into this
+     *  instance when the batch completes.
+     *
+     *  @param[in,out] measCat     Catalog of sources to measure; provides the same
+     *                             per-record inputs and outputs as measure().
+     *  @param[in]     exposure    Image to be measured.  Must have a valid Psf, Wcs,
+     *                             and PhotoCalib.
+     *  @param[in]     nThreads    Number of fit worker threads (1 = run serially in
+     *                             the calling thread).
+     *  @param[in]     largestFirst  If true (the default) and more than one thread is
+     *                             used, dispatch sources to the workers in decreasing
+     *                             order of detection footprint area rather than
+     *                             catalog order.  The few giant footprints that
+     *                             dominate the runtime then start immediately instead
+     *                             of becoming end-of-catalog stragglers on an
+     *                             otherwise idle pool.  The processing order has no
+     *                             effect on the output.
+     *
+     *  To run this method, the CModelAlgorithm instance must have been created using
+     *  the constructor that takes a Schema argument, and that Schema must match the
+     *  Schema of the catalog passed here.
+     */
+    void measureBatch(
+        afw::table::SourceCatalog & measCat,
+        afw::image::Exposure<Pixel> const & exposure,
+        int nThreads=1,
+        bool largestFirst=true
+    ) const;
+
     /**
      *  Handle an exception thrown by one of the measure() methods, setting the appropriate flag in
      *  the given record.
@@ -545,10 +689,54 @@ public:
     /// Copy values from a Result struct to a BaseRecord object.
     void writeResultToRecord(Result const & result, afw::table::BaseRecord & record) const;
 
+    /// Return the performance counters accumulated over all sources measured by this instance.
+    CModelStats getStats() const;
+
+    /// Reset all performance counters to zero (e.g. between CCDs).
+    void resetStats() const;
+
+    /**
+     *  Enable or disable the per-source profiling sink.
+     *
+     *  While enabled, every call to measure(measRecord, exposure) — and every source
+     *  processed by measureBatch() — appends a CModelSourceProfile record (including
+     *  sources that fail), at the cost of one extra clock read and a small allocation
+     *  per source.  Records from measureBatch worker threads are merged back into this
+     *  instance when the batch completes; after a threaded batch they appear in
+     *  per-worker order rather than catalog order.  Disabled by default; previously
+     *  collected records are kept until clearSourceProfiles() is called.
+     */
+    void setProfilingEnabled(bool enabled) const;
+
+    /// Return whether the per-source profiling sink is enabled.
+    bool getProfilingEnabled() const;
+
+    /// Return the per-source profiling records collected while profiling was enabled.
+    std::vector<CModelSourceProfile> const & getSourceProfiles() const;
+
+    /// Discard all collected per-source profiling records.
+    void clearSourceProfiles() const;
+
+    /**
+     *  Format a human-readable end-of-run report from the collected profiling records:
+     *  per-source wall-time percentiles, followed by the topN slowest sources with their
+     *  IDs, iteration counts, footprint areas, and set failure flags.
+     */
+    std::string formatProfileReport(int topN=10) const;
+
 private:
 
     friend class CModelAlgorithmControl;
 
+    // Pixel data pre-extracted for one source by the producer thread in
+    // measureBatch: the initial fit region and a likelihood holding the
+    // flattened pixel buffers covering it.  Null pointers mean extraction was
+    // skipped and the fit should gather its own pixels.
+    struct PrefetchedPixels {
+        std::shared_ptr<afw::detection::Footprint> footprint;
+        std::shared_ptr<UnitTransformedLikelihood> likelihood;
+    };
+
     // Actual implementations go here; we use an output argument for the result so we can get partial
     // results to the plugin version when we throw.
     void _applyImpl(
@@ -559,7 +747,39 @@ private:
         afw::geom::ellipses::Quadrupole const & moments,
         Scalar approxFlux,
         Scalar kronRadius=-1,
-        int footprintArea=-1
+        int footprintArea=-1,
+        Result const * warmStart=nullptr,
+        PrefetchedPixels const * prefetched=nullptr
+    ) const;
+
+    // Extract the initial fit region and its pixel buffers for one source,
+    // mirroring the input handling of measure() and the region logic of
+    // _applyImpl.  Returns an empty struct when the inputs or region are
+    // invalid; conclusive failures are left for the fitting pass to
+    // rediscover and flag.
+    PrefetchedPixels _prefetchPixels(
+        afw::table::SourceRecord & measRecord,
+        afw::image::Exposure<Pixel> const & exposure
+    ) const;
+
+    // Implementation of measure(measRecord, exposure); when prefetched is
+    // non-null and covers exactly the pixels of the initial fit region, its
+    // buffers are shared instead of re-extracted from the exposure.
+    void _measureImpl(
+        afw::table::SourceRecord & measRecord,
+        afw::image::Exposure<Pixel> const & exposure,
+        PrefetchedPixels const * prefetched
+    ) const;
+
+    // Compute-only core of _measureImpl: fills the result without writing it
+    // back to the record, so measureBatch can buffer a block of results and
+    // write all its output columns contiguously afterwards.  Exceptions
+    // propagate with the partial result intact, as in _applyImpl.
+    void _computeMeasurement(
+        afw::table::SourceRecord & measRecord,
+        afw::image::Exposure<Pixel> const & exposure,
+        PrefetchedPixels const * prefetched,
+        Result & result
     ) const;
 
     // Actual implementations go here; we use an output argument for the result so we can get partial
@@ -582,6 +802,10 @@ private:
 
     class Impl;
 
+    // Used by measureBatch to create per-thread workers that share schema keys
+    // with the original algorithm but have their own per-stage fitting state.
+    CModelAlgorithm(Control const & ctrl, std::shared_ptr<Impl> impl);
+
     Control _ctrl;
     std::shared_ptr<Impl> _impl;
 };
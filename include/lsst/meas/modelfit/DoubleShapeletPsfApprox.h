@@ -251,6 +251,28 @@ public:
         afw::image::Exposure<float> const & exposure
     ) const;
 
+    /**
+     *  Run the algorithm on all sources in a catalog, reusing work between sources.
+     *
+     *  This is equivalent to calling measure(record, exposure) on every record in
+     *  the catalog, with two batch-level optimizations: the flattened-pixel scratch
+     *  arrays used by the profile and shapelet fitting stages are allocated once and
+     *  reused across sources, and when a source's realized PSF kernel image is
+     *  identical to the previous source's (as is common in dense fields when the
+     *  PSF model is constant or piecewise-constant in position), the previous fit
+     *  is copied instead of being redone.  Per-source failures are handled the way
+     *  the measurement framework plugin handles them: the appropriate failure flags
+     *  are set on the record and the loop continues.
+     *
+     *  @param[in,out] measCat   Catalog of sources to measure; provides the same
+     *                           per-record inputs and outputs as measure().
+     *  @param[in]     exposure  Image whose Psf will be fit.
+     */
+    void measureBatch(
+        afw::table::SourceCatalog & measCat,
+        afw::image::Exposure<float> const & exposure
+    ) const;
+
     /**
      *  Handle failures caught by the measurement plugin system, setting failure flags as appropriate.
      */
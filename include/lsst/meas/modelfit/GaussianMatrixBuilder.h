@@ -0,0 +1,122 @@
+// -*- lsst-c++ -*-
+/*
+ * LSST Data Management System
+ * Copyright 2008-2013 LSST Corporation.
+ *
+ * This product includes software developed by the
+ * LSST Project (http://www.lsst.org/).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the LSST License Statement and
+ * the GNU General Public License along with this program.  If not,
+ * see <http://www.lsstcorp.org/LegalNotices/>.
+ */
+
+#ifndef LSST_MEAS_MODELFIT_GaussianMatrixBuilder_h_INCLUDED
+#define LSST_MEAS_MODELFIT_GaussianMatrixBuilder_h_INCLUDED
+
+#include <vector>
+
+#include "Eigen/Core"
+#include "ndarray.h"
+
+#include "lsst/afw/geom/ellipses/Ellipse.h"
+#include "lsst/shapelet/MultiShapeletBasis.h"
+#include "lsst/shapelet/MultiShapeletFunction.h"
+#include "lsst/meas/modelfit/common.h"
+
+namespace lsst { namespace meas { namespace modelfit {
+
+/**
+ *  @brief Direct elliptical-Gaussian model matrix evaluator for order-0 bases.
+ *
+ *  When every component of a MultiShapeletBasis and of the PSF approximation has
+ *  order zero (as with the few-Gaussian profile approximations used by the CModel
+ *  initial stage and the SingleGaussian/DoubleGaussian PSF models), the convolved
+ *  basis functions are plain elliptical Gaussians, and the general shapelet
+ *  expansion machinery of shapelet::MatrixBuilder is unnecessary overhead.  This
+ *  class precomputes the per-(basis component, PSF component) covariance terms at
+ *  construction and fills the model matrix with vectorized Gaussian evaluations,
+ *  producing the same values (up to floating-point rounding) as a MatrixBuilder
+ *  constructed from the same inputs.
+ *
+ *  Like MatrixBuilder, an instance holds internal scratch space, so concurrent
+ *  calls to operator() on the same object are not safe.
+ */
+class GaussianMatrixBuilder {
+public:
+
+    /// Return true if every basis and PSF component has order zero.
+    static bool isCompatible(
+        shapelet::MultiShapeletBasis const & basis,
+        shapelet::MultiShapeletFunction const & psf
+    );
+
+    /**
+     *  @brief Construct a builder bound to a set of pixel coordinates.
+     *
+     *  @param[in] x, y     Flattened pixel coordinates of the region to evaluate on.
+     *  @param[in] basis    Basis to evaluate; all components must have order zero.
+     *  @param[in] psf      PSF to convolve with; all components must have order zero.
+     *
+     *  Throws InvalidParameterError if any basis or PSF component has nonzero order
+     *  (i.e. if isCompatible() would return false).
+     */
+    GaussianMatrixBuilder(
+        ndarray::Array<Pixel const,1,1> const & x,
+        ndarray::Array<Pixel const,1,1> const & y,
+        shapelet::MultiShapeletBasis const & basis,
+        shapelet::MultiShapeletFunction const & psf
+    );
+
+    /// Return the number of basis functions (columns of the model matrix).
+    int getBasisSize() const { return _basisSize; }
+
+    /// Return the number of pixels (rows of the model matrix).
+    int getDataSize() const { return static_cast<int>(_x.size()); }
+
+    /**
+     *  @brief Accumulate the convolved basis evaluated at the given ellipse into a matrix.
+     *
+     *  @param[out] output    Matrix with shape (getDataSize(), getBasisSize()) to add into;
+     *                        the caller is responsible for zeroing it first, as with
+     *                        shapelet::MatrixBuilder.
+     *  @param[in]  ellipse   Ellipse whose core is scaled by each component's radius, as in
+     *                        MultiShapeletBasis::makeFunction().
+     */
+    void operator()(
+        ndarray::Array<Pixel,2,-1> const & output,
+        afw::geom::ellipses::Ellipse const & ellipse
+    ) const;
+
+private:
+
+    // One (basis component, PSF component) pair: the model covariance is scaled by r2
+    // and added to the PSF component's quadrupole, and the resulting Gaussian is
+    // accumulated with per-amplitude coefficients.
+    struct Term {
+        double r2;                 // square of the basis component's radius factor
+        double pxx, pyy, pxy;      // PSF component quadrupole moments
+        double px, py;             // PSF component center offset
+        Eigen::VectorXd coefficients;  // 2 * (PSF coefficient) * (basis matrix row), per amplitude
+    };
+
+    int _basisSize;
+    Eigen::ArrayXd _x;
+    Eigen::ArrayXd _y;
+    std::vector<Term> _terms;
+    mutable Eigen::ArrayXd _scratch;
+};
+
+}}} // namespace lsst::meas::modelfit
+
+#endif // !LSST_MEAS_MODELFIT_GaussianMatrixBuilder_h_INCLUDED
@@ -90,7 +90,8 @@ class GeneralPsfFitterControl {
 public:
 
     GeneralPsfFitterControl() :
-        inner(-1, 0.5), primary(0, 1.0), wings(0, 2.0), outer(-1, 4.0), defaultNoiseSigma(0.001)
+        inner(-1, 0.5), primary(0, 1.0), wings(0, 2.0), outer(-1, 4.0), defaultNoiseSigma(0.001),
+        warmStartRadius(0.0), doCoarsePass(false), coarseBinFactor(2)
     {}
 
     LSST_NESTED_CONTROL_FIELD(
@@ -122,6 +123,28 @@ public:
         defaultNoiseSigma, double, "Default value for the noiseSigma parameter in GeneralPsfFitter.apply()"
     );
 
+    LSST_CONTROL_FIELD(
+        warmStartRadius, double,
+        "If positive, cache fit results keyed by position, and when a new fit is requested via the "
+        "position-aware apply() overload, use the nearest cached result within this distance (in pixels) "
+        "as the starting point instead of a cold start from moments.  Zero or negative disables the cache."
+    );
+
+    LSST_CONTROL_FIELD(
+        doCoarsePass, bool,
+        "If true, precede each cold-start fit with a fit of the order-0 version of the same components "
+        "on a binned copy of the PSF image, and use its (adapted) solution as the starting point for the "
+        "full fit.  This typically cuts total optimizer iterations substantially for high-order "
+        "configurations.  Fits that already start from a previous solution (the initial-guess apply() "
+        "overload and warm-start cache hits) skip the coarse pass."
+    );
+
+    LSST_CONTROL_FIELD(
+        coarseBinFactor, int,
+        "Bin factor applied to the PSF image in the coarse pass when doCoarsePass is true; 1 fits the "
+        "order-0 model at full resolution."
+    );
+
 };
 
 /**
@@ -258,10 +281,67 @@ public:
     }
     //@}
 
+    //@{
+    /**
+     *  Perform a fit to a PSF image, warm-starting from cached fits of nearby sources.
+     *
+     *  If the control object's warmStartRadius is positive and a previous fit within that distance
+     *  of the given position exists in the cache, that fit is used as the starting point instead of
+     *  a cold start from the given moments; the PSF typically varies slowly enough across a CCD
+     *  that this converges in far fewer optimizer iterations.  The result of each fit is added to
+     *  the cache.  If warmStartRadius is not positive, this is equivalent to the position-less
+     *  overload.  The cache is shared between copies of this fitter and is not thread-safe.
+     *
+     *  @param[in]  image       The image to fit, typically the result of Psf::computeKernelImage().
+     *  @param[in]  moments     Second moments of the PSF, used for a cold start when no cached fit
+     *                          is close enough.
+     *  @param[in]  position    Position of the source in the image the PSF model belongs to (not
+     *                          the PSF image), used as the cache key.
+     *  @param[in]  noiseSigma  An estimate of the noise in the image (see other overloads).
+     *  @param[in]  pState      Pointer to an integer which is used to return the optimizerState.
+     */
+    shapelet::MultiShapeletFunction apply(
+        afw::image::Image<Pixel> const & image,
+        afw::geom::ellipses::Quadrupole const & moments,
+        geom::Point2D const & position,
+        Scalar noiseSigma=-1,
+        int * pState = nullptr
+    ) const;
+    shapelet::MultiShapeletFunction apply(
+        afw::image::Image<double> const & image,
+        afw::geom::ellipses::Quadrupole const & moments,
+        geom::Point2D const & position,
+        Scalar noiseSigma=-1,
+        int * pState = nullptr
+    ) const {
+        return apply(afw::image::Image<float>(image, true), moments, position, noiseSigma, pState);
+    }
+    //@}
+
+    /// Return the number of fits held by the warm-start cache (always zero when it is disabled).
+    std::size_t getCacheSize() const;
+
+    /// Discard all cached fits (e.g. when moving on to a new detector).
+    void clearCache();
+
 private:
+    class SpatialCache;
+
+    // Shared implementation of the initial-guess apply() overloads; binFactor is
+    // passed through to MultiShapeletPsfLikelihood (1 for full resolution).
+    shapelet::MultiShapeletFunction _applyImpl(
+        afw::image::Image<Pixel> const & image,
+        shapelet::MultiShapeletFunction const & initial,
+        Scalar noiseSigma,
+        int * pState,
+        int binFactor
+    ) const;
+
     GeneralPsfFitterControl _ctrl;
     std::shared_ptr<Model> _model;
     std::shared_ptr<Prior> _prior;
+    std::shared_ptr<SpatialCache> _cache;
+    std::shared_ptr<GeneralPsfFitter> _coarse;  // order-0 companion fitter for the coarse pass
 };
 
 class GeneralPsfFitterAlgorithm : public GeneralPsfFitter {
@@ -315,12 +395,19 @@ private:
 class MultiShapeletPsfLikelihood : public Likelihood {
 public:
 
+    /**
+     *  If binFactor is greater than one, the image is bin-averaged by that factor and the
+     *  model is evaluated at the bin centers, still in full-resolution pixel units; this is
+     *  used by GeneralPsfFitter's coarse pass, where an approximate fit to fewer pixels is
+     *  all that's needed.
+     */
     MultiShapeletPsfLikelihood(
         ndarray::Array<Pixel const,2,1> const & image,
         geom::Point2I const & xy0,
         std::shared_ptr<Model> model,
         Scalar sigma,
-        ndarray::Array<Scalar const,1,1> const & fixed
+        ndarray::Array<Scalar const,1,1> const & fixed,
+        int binFactor=1
     );
 
     void computeModelMatrix(
@@ -329,11 +416,18 @@ public:
         bool doApplyWeights=true
     ) const override;
 
+    /// Return an independent copy that can evaluate the model concurrently with this one.
+    std::shared_ptr<Likelihood> clone() const override;
+
     virtual ~MultiShapeletPsfLikelihood();
 
 private:
     class Impl;
     std::unique_ptr<Impl> _impl;
+    ndarray::Array<Pixel const,2,1> _image;
+    geom::Point2I _xy0;
+    Scalar _sigma;
+    int _binFactor;
 };
 
 }}} // namespace lsst::meas::modelfit
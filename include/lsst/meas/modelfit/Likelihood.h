@@ -24,6 +24,8 @@
 #ifndef LSST_MEAS_MODELFIT_Likelihood_h_INCLUDED
 #define LSST_MEAS_MODELFIT_Likelihood_h_INCLUDED
 
+#include <cstdint>
+
 #include "ndarray_fwd.h"
 
 #include "lsst/pex/exceptions.h"
@@ -123,6 +125,61 @@ public:
         bool doApplyWeights=true
     ) const = 0;
 
+    /**
+     *  @brief Normal-equations terms for an amplitude-only (linear) fit at fixed nonlinear parameters.
+     *
+     *  All quantities are defined in terms of the unweighted model matrix @f$A@f$ (what
+     *  computeModelMatrix fills when doApplyWeights is false), the unweighted data vector
+     *  @f$y@f$, and the per-pixel variances @f$\Sigma@f$.
+     */
+    struct FitStatistics {
+
+        Matrix modelSquared;         ///< normal-equations matrix @f$A^T A@f$
+        Matrix modelSquaredVariance; ///< variance-weighted normal-equations matrix @f$A^T \Sigma A@f$
+        Vector modelDotData;         ///< data projected onto the model, @f$A^T y@f$
+        Vector modelSum;             ///< per-amplitude sums of model values, @f$A^T 1@f$
+        Scalar dataSquaredNorm;      ///< squared norm of the data vector, @f$y^T y@f$
+
+        /// Construct with all terms zeroed, ready for accumulation.
+        explicit FitStatistics(int amplitudeDim);
+    };
+
+    /**
+     *  @brief Compute the terms needed for an amplitude-only fit without exposing the model matrix.
+     *
+     *  Together these are sufficient to solve the linear problem and evaluate chi-squared and
+     *  effective-aperture flux statistics for any amplitude vector, so callers that never need
+     *  the model matrix itself (e.g. the final CModel linear fit and forced photometry) can
+     *  avoid materializing it.  The default implementation builds the full matrix internally
+     *  and forms the products from it; subclasses may override this with a fused evaluation
+     *  that streams over blocks of pixels.
+     *
+     *  @param[in] nonlinear   Vector of nonlinear parameters at which to evaluate the model.
+     */
+    virtual FitStatistics computeFitStatistics(
+        ndarray::Array<Scalar const,1,1> const & nonlinear
+    ) const;
+
+    /**
+     *  @brief Return an independent Likelihood over the same data, or null if unsupported.
+     *
+     *  The returned object must be able to evaluate computeModelMatrix concurrently with
+     *  the original (i.e. it must not share mutable workspace with it).  This is used by
+     *  the Optimizer to parallelize numeric differentiation; the default implementation
+     *  returns null, which disables that parallelism for this Likelihood.
+     */
+    virtual std::shared_ptr<Likelihood> clone() const { return nullptr; }
+
+    /**
+     *  Return the number of times the model has been evaluated on this object, either
+     *  through computeModelMatrix or through the fused computeFitStatistics.
+     *
+     *  Implementations of computeModelMatrix are responsible for incrementing the counter;
+     *  it exists so callers can attribute model evaluation costs without wrapping the
+     *  Likelihood (see e.g. CModelStats).
+     */
+    std::int64_t getModelMatrixCount() const { return _modelMatrixCount; }
+
     virtual ~Likelihood() {}
 
     // No copying
@@ -136,7 +193,7 @@ public:
 protected:
 
     Likelihood(std::shared_ptr<Model> model, ndarray::Array<Scalar const,1,1> const & fixed) :
-        _model(model), _fixed(fixed) {
+        _modelMatrixCount(0), _model(model), _fixed(fixed) {
         LSST_THROW_IF_NE(
             fixed.getSize<0>(), static_cast<std::size_t>(model->getFixedDim()),
             pex::exceptions::LengthError,
@@ -144,6 +201,7 @@ protected:
         );
     }
 
+    mutable std::int64_t _modelMatrixCount;
     std::shared_ptr<Model> _model;
     ndarray::Array<Scalar const,1,1> _fixed;
     ndarray::Array<Pixel,1,1> _data;
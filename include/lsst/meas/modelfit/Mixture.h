@@ -72,6 +72,16 @@ public:
     void setSigma(Matrix const & sigma);
     //@}
 
+    /**
+     *  @brief Return true if sigma is exactly diagonal.
+     *
+     *  Detected automatically whenever sigma is set; diagonal components are
+     *  evaluated and drawn from with specialized kernels that replace the
+     *  triangular solve against the Cholesky factor with element-wise scaling
+     *  (see Mixture::setDiagonalCovariance).
+     */
+    bool isDiagonal() const { return _isDiagonal; }
+
     /// Project the distribution onto the given dimension (marginalize over all others)
     MixtureComponent project(int dim) const;
 
@@ -98,6 +108,9 @@ private:
     void _stream(std::ostream & os, int offset=0) const;
 
     Scalar _sqrtDet;
+    Scalar _sigmaSpecBound;  // upper bound on the largest eigenvalue of sigma (see
+                             // Mixture::setComponentPruningThreshold)
+    bool _isDiagonal;
     Vector _mu;
     Eigen::LLT<Matrix> _sigmaLLT;
 };
@@ -189,14 +202,78 @@ public:
     /// Set the number of degrees of freedom in the component Student's T distributions (inf=Gaussian)
     void setDegreesOfFreedom(Scalar df=std::numeric_limits<Scalar>::infinity());
 
+    /// Get the number of threads used by updateEM (1 = serial, the default)
+    int getUpdateThreadCount() const { return _updateThreadCount; }
+
+    /**
+     *  @brief Set the number of threads used by updateEM (1 = serial, the default)
+     *
+     *  When more than one thread is requested, the responsibility matrix is filled in
+     *  parallel over contiguous blocks of samples, and the component updates are
+     *  distributed over components, each accumulated with its own partial sums and
+     *  merged in component order.  Because both decompositions have no cross-thread
+     *  data dependencies, the results are bitwise identical for any thread count.
+     *
+     *  Any UpdateRestriction passed to updateEM must be safe to call concurrently
+     *  when the thread count is greater than one.
+     */
+    void setUpdateThreadCount(int nThreads);
+
+    /// Return whether component covariances are restricted to diagonal form (false is the default)
+    bool getDiagonalCovariance() const { return _diagonalCovariance; }
+
+    /**
+     *  @brief Restrict (or stop restricting) component covariances to diagonal form.
+     *
+     *  When enabled, the off-diagonal elements of every component's sigma matrix are
+     *  dropped immediately, and the covariances produced by subsequent updateEM calls
+     *  are projected to their diagonals before being applied.  Diagonal components are
+     *  evaluated and drawn from with specialized kernels that replace the triangular
+     *  solve against the Cholesky factor with element-wise scaling, which roughly
+     *  halves the per-sample cost for the small dimensions used by our priors; this
+     *  is an approximation that is only appropriate for mixtures whose components are
+     *  known to be nearly axis-aligned.
+     *
+     *  Disabling the restriction does not restore previously dropped off-diagonal
+     *  elements; it only allows later updates to produce dense covariances again.
+     *  The restriction is a runtime fitting option and is not persisted.
+     */
+    void setDiagonalCovariance(bool diagonal);
+
+    /// Return the relative density level below which components are skipped (0 = exact, the default)
+    Scalar getComponentPruningThreshold() const { return _pruneThreshold; }
+
+    /**
+     *  @brief Skip components whose contribution at a point is provably below the given
+     *         fraction of their peak density.
+     *
+     *  When a positive threshold is set, the PDF evaluate methods compute a lower bound
+     *  on each component's Mahalanobis distance to a point from the Euclidean distance
+     *  and an upper bound on the spectral radius of sigma, and treat the component's
+     *  contribution as zero when that bound exceeds the distance at which the component
+     *  density falls to `threshold` times its peak.  The cutoff distance accounts for
+     *  the degrees of freedom, so the heavier tails of Student's T components push it
+     *  outward relative to the Gaussian case.  This is an approximation appropriate for
+     *  mixtures whose components are separated by many sigma, like our empirical
+     *  priors; thresholds far below the density range of interest (e.g. 1E-15) keep
+     *  the error near double-precision round-off.  Derivative, per-component, and
+     *  updateEM computations are never pruned.  Zero (the default) disables pruning;
+     *  the threshold is a runtime evaluation option and is not persisted.
+     */
+    void setComponentPruningThreshold(Scalar threshold);
+
     /**
      *  @brief Evaluate the probability density at the given point for the given component distribution.
      *
      *  This evaluates the probability of a single component, including the current weight of that component.
+     *
+     *  All evaluation and draw members use only local scratch, so they may be
+     *  called concurrently on a single const Mixture shared between threads.
      */
     template <typename Derived>
     Scalar evaluate(Component const & component, Eigen::MatrixBase<Derived> const & x) const {
-        Scalar z = _computeZ(component, x);
+        Vector workspace(component.getDimension());
+        Scalar z = _computeZ(component, x, workspace);
         return component.weight * _evaluate(z) / component._sqrtDet;
     }
 
@@ -207,9 +284,15 @@ public:
      */
     template <typename Derived>
     Scalar evaluate(Eigen::MatrixBase<Derived> const & x) const {
+        Vector workspace(_dim);
         Scalar p = 0.0;
+        bool const prune = _pruneZCut != std::numeric_limits<Scalar>::infinity();
         for (const_iterator i = begin(); i != end(); ++i) {
-            p += evaluate(*i, x);
+            if (prune && (x - i->_mu).squaredNorm() > _pruneZCut*i->_sigmaSpecBound) {
+                continue;  // see setComponentPruningThreshold
+            }
+            Scalar z = _computeZ(*i, x, workspace);
+            p += i->weight * _evaluate(z) / i->_sqrtDet;
         }
         return p;
     }
@@ -219,6 +302,10 @@ public:
      *
      *  @param[in] x       array of points, shape=(numSamples, dim)
      *  @param[out] p      array of probability values, shape=(numSamples,)
+     *
+     *  This delegates to a blocked kernel that processes cache-sized groups of
+     *  points per component with vectorized Eigen array operations, which is
+     *  substantially faster than repeated calls to the single-point overload.
      */
     void evaluate(
         ndarray::Array<Scalar const,2,1> const & x,
@@ -363,6 +450,27 @@ public:
 
     virtual bool isPersistable() const noexcept override { return true; }
 
+    /**
+     *  @brief Save the mixture to a compact flat binary file.
+     *
+     *  The format is a small fixed-size header followed by the component weights,
+     *  mu vectors, and sigma matrices as contiguous arrays of doubles.  It exists
+     *  as a fast alternative to the table-based persistence for mixtures that are
+     *  loaded at every worker startup (e.g. the empirical prior used by
+     *  MixturePrior); it is not a replacement for afw::table::io persistence and
+     *  makes no attempt to be portable across architectures.
+     */
+    void writeCompact(std::string const & filename) const;
+
+    /**
+     *  @brief Load a mixture written by writeCompact.
+     *
+     *  The file is memory-mapped read-only, so concurrent workers on one node
+     *  share the page cache rather than each reading the file; only the
+     *  per-component Cholesky factorizations are computed per process.
+     */
+    static std::shared_ptr<Mixture> readCompact(std::string const & filename);
+
 protected:
 
     std::string getPythonModule() const override { return "lsst.meas.modelfit"; }
@@ -379,24 +487,89 @@ private:
                                   bool computeHessian = true) const;
 
     template <typename Derived>
-    Scalar _computeZ(Component const & component, Eigen::MatrixBase<Derived> const & x) const {
-        _workspace = x - component._mu;
-        component._sigmaLLT.matrixL().solveInPlace(_workspace);
-        return _workspace.squaredNorm();
+    Scalar _computeZ(
+        Component const & component,
+        Eigen::MatrixBase<Derived> const & x,
+        Vector & workspace
+    ) const {
+        workspace = x - component._mu;
+        if (component._isDiagonal) {
+            // The Cholesky factor of a diagonal sigma is diagonal, so the
+            // triangular solve reduces to element-wise division.
+            workspace.array() /= component._sigmaLLT.matrixLLT().diagonal().array();
+        } else {
+            component._sigmaLLT.matrixL().solveInPlace(workspace);
+        }
+        return workspace.squaredNorm();
     }
 
-    // Helper function used in updateEM
+    // Blocked implementation behind the array overload of evaluate
+    void _evaluateBlocked(
+        ndarray::Array<Scalar const,2,1> const & x,
+        ndarray::Array<Scalar,1,0> const & p
+    ) const;
+
+    // Fixed-dimension kernels behind _evaluateBlocked, _evaluateDerivativesImpl,
+    // and _computeResponsibilities, selected by a runtime switch on _dim for the
+    // common small dimensions (1, 2, 3).  With Eigen::Matrix<Scalar,N,...>
+    // storage the triangular solves and quadratic forms fully unroll and no
+    // heap-allocated temporaries are created.
+    template <int N>
+    void _evaluateBlockedFixed(
+        ndarray::Array<Scalar const,2,1> const & x,
+        ndarray::Array<Scalar,1,0> const & p
+    ) const;
+
+    template <int N, typename A, typename B, typename C>
+    void _evaluateDerivativesFixed(
+        A const & x,
+        B & gradient,
+        C * hessian,
+        bool computeHessian
+    ) const;
+
+    template <int N>
+    void _computeResponsibilitiesFixed(
+        ndarray::Array<Scalar const,2,1> const & x,
+        ndarray::Array<Scalar const,1,0> const & w,
+        Matrix & p, Matrix & gamma,
+        int rowBegin, int rowEnd
+    ) const;
+
+    // Helper functions used in updateEM
+    void _computeResponsibilities(
+        ndarray::Array<Scalar const,2,1> const & x,
+        ndarray::Array<Scalar const,1,0> const & w,
+        Matrix & p, Matrix & gamma,
+        int rowBegin, int rowEnd
+    ) const;
+
+    void _updateComponentEM(
+        int k,
+        ndarray::Array<Scalar const,2,1> const & x,
+        Matrix const & p, Matrix const & gamma,
+        UpdateRestriction const & restriction,
+        Scalar tau1, Scalar tau2
+    );
+
     void updateDampedSigma(int k, Matrix const & sigma, double tau1, double tau2);
 
+    // Recompute the Mahalanobis-distance cutoff from the pruning threshold and the
+    // current degrees of freedom (infinity when pruning is disabled).
+    void _updatePruneZCut();
+
     Scalar _evaluate(Scalar z) const;
 
     void _stream(std::ostream & os) const;
 
     bool _isGaussian;
+    bool _diagonalCovariance;
     int _dim;
+    int _updateThreadCount;
     Scalar _df;
     Scalar _norm;
-    mutable Vector _workspace;
+    Scalar _pruneThreshold;
+    Scalar _pruneZCut;
     ComponentList _components;
 };
 
@@ -43,6 +43,13 @@ public:
         ndarray::Array<Scalar const,1,1> const & amplitudes
     ) const override;
 
+    /// Batched evaluation that delegates to the Mixture's blocked array overload.
+    void evaluate(
+        ndarray::Array<Scalar const,2,1> const & nonlinear,
+        ndarray::Array<Scalar const,2,1> const & amplitudes,
+        ndarray::Array<Scalar,1,1> const & out
+    ) const override;
+
     /// @copydoc Prior::evaluateDerivatives
     void evaluateDerivatives(
         ndarray::Array<Scalar const,1,1> const & nonlinear,
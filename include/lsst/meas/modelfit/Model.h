@@ -217,6 +217,26 @@ public:
         ndarray::Array<Scalar const,1,1> const & fixed
     ) const;
 
+    /**
+     *  @brief Convert a set of nonlinear+fixed parameter arrays to a vector of ellipses in-place.
+     *
+     *  @param[in] nonlinear        nonlinear parameter array.
+     *  @param[in] fixed            fixed parameter array.
+     *  @param[out] ellipses        Ellipse vector to fill, as returned by makeEllipseVector().
+     *
+     *  Unlike the overload that returns a new EllipseVector, this overload performs no heap
+     *  allocation, making it the preferred form when converting parameters every iteration
+     *  of a fit with reused ellipse storage.
+     *
+     *  @warning The EllipseVector must have been originally constructed by
+     *           makeEllipseVector()
+     */
+    void writeEllipses(
+        ndarray::Array<Scalar const,1,1> const & nonlinear,
+        ndarray::Array<Scalar const,1,1> const & fixed,
+        EllipseVector & ellipses
+    ) const;
+
     /**
      *  @brief Convert a vector of ellipses to a set of nonlinear+fixed parameter arrays.
      *
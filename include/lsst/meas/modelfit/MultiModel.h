@@ -64,6 +64,21 @@ public:
         Scalar * nonlinearIter, Scalar * fixedIter
     ) const override;
 
+    /**
+     *  @copydoc Model::transformParameters
+     *
+     *  This override dispatches to each component model on shared views of the
+     *  concatenated parameter arrays, so components transform their segments in
+     *  place (honoring any component overrides) with no temporary copies or
+     *  per-call ellipse vector allocation.
+     */
+    void transformParameters(
+        LocalUnitTransform const & transform,
+        ndarray::Array<Scalar,1,1> const & nonlinear,
+        ndarray::Array<Scalar,1,1> const & amplitudes,
+        ndarray::Array<Scalar,1,1> const & fixed
+    ) const override;
+
 private:
     ModelVector _components;
 };
@@ -43,7 +43,8 @@ struct PixelFitRegionControl {
         nFitRadiiMin(1.0),
         nFitRadiiMax(3.0),
         maxArea(100000),
-        maxBadPixelFraction(0.1)
+        maxBadPixelFraction(0.1),
+        circularSpanTemplateTolerance(0.0)
     {
         badMaskPlanes.push_back("EDGE");
         badMaskPlanes.push_back("SAT");
@@ -97,6 +98,16 @@ struct PixelFitRegionControl {
         "more than this and we don't even try."
     );
 
+    LSST_CONTROL_FIELD(
+        circularSpanTemplateTolerance, double,
+        "If positive, nearly-circular fit regions (semi-axis difference below this many pixels) "
+        "are built from precomputed integer-radius circular span templates shared across all "
+        "sources instead of rasterizing the exact ellipse, with the region rounded up to the "
+        "enclosing circle at the nearest pixel center.  This skips per-source rasterization for "
+        "PSF-sized sources at the cost of slightly enlarged, circularized regions.  "
+        "Zero (the default) disables the fast path and preserves exact region geometry."
+    );
+
 };
 
 
@@ -25,6 +25,7 @@
 #define LSST_MEAS_MODELFIT_Prior_h_INCLUDED
 
 #include "lsst/base.h"
+#include "lsst/pex/exceptions.h"
 #include "lsst/afw/math/Random.h"
 #include "lsst/meas/modelfit/common.h"
 
@@ -49,6 +50,36 @@ public:
         ndarray::Array<Scalar const,1,1> const & amplitudes
     ) const = 0;
 
+    /**
+     *  @brief Evaluate the prior at multiple points at once.
+     *
+     *  @param[in]   nonlinear        Matrix of nonlinear parameters, shape=(numSamples, nonlinearDim)
+     *  @param[in]   amplitudes       Matrix of linear parameters, shape=(numSamples, amplitudeDim)
+     *  @param[out]  out              Array of prior values, shape=(numSamples,)
+     *
+     *  The default implementation simply calls the single-point evaluate once per row;
+     *  subclasses whose densities can be vectorized over samples should override it.
+     */
+    virtual void evaluate(
+        ndarray::Array<Scalar const,2,1> const & nonlinear,
+        ndarray::Array<Scalar const,2,1> const & amplitudes,
+        ndarray::Array<Scalar,1,1> const & out
+    ) const {
+        LSST_THROW_IF_NE(
+            nonlinear.getSize<0>(), amplitudes.getSize<0>(),
+            pex::exceptions::LengthError,
+            "Number of nonlinear parameter rows (%d) does not match number of amplitude rows (%d)"
+        );
+        LSST_THROW_IF_NE(
+            nonlinear.getSize<0>(), out.getSize<0>(),
+            pex::exceptions::LengthError,
+            "Number of nonlinear parameter rows (%d) does not match number of output values (%d)"
+        );
+        for (std::size_t k = 0; k < out.getSize<0>(); ++k) {
+            out[k] = evaluate(nonlinear[k], amplitudes[k]);
+        }
+    }
+
     /**
      *  @brief Evaluate the derivatives of the prior at the given point in nonlinear and amplitude space.
      *
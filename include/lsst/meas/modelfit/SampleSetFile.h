@@ -0,0 +1,104 @@
+// -*- lsst-c++ -*-
+/*
+ * LSST Data Management System
+ * Copyright 2008-2013 LSST Corporation.
+ *
+ * This product includes software developed by the
+ * LSST Project (http://www.lsst.org/).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the LSST License Statement and
+ * the GNU General Public License along with this program.  If not,
+ * see <http://www.lsstcorp.org/LegalNotices/>.
+ */
+
+#ifndef LSST_MEAS_MODELFIT_SampleSetFile_h_INCLUDED
+#define LSST_MEAS_MODELFIT_SampleSetFile_h_INCLUDED
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "lsst/afw/table/Catalog.h"
+#include "lsst/meas/modelfit/common.h"
+
+namespace lsst { namespace meas { namespace modelfit {
+
+/**
+ *  @brief Append-only columnar binary store for importance-sampling sample sets
+ *
+ *  Serializing per-object sample catalogs through FITS costs far more than the
+ *  sampling itself when many objects are processed, and reading them back
+ *  materializes a full afw::table catalog per object.  This writer instead
+ *  appends each sample set to a flat binary file as contiguous columns, so
+ *  downstream quantile/percentile code can memory-map the file and wrap the
+ *  columns as arrays without copying.
+ *
+ *  The layout is deliberately trivial (native-endian, no compression):
+ *   - file header: 8-byte magic "MFSAMPLE", int64 version (currently 1),
+ *     int64 parameter dimension
+ *   - one block per appended sample set: int64 id, int64 nSamples, followed by
+ *     the weight, objective, and proposal columns (nSamples doubles each) and
+ *     the parameters column (nSamples*parameterDim doubles, sample-major)
+ *
+ *  Blocks are flushed as they are appended, so a partially-written file is
+ *  valid up to its last complete block.  See readSampleSetFile() in the Python
+ *  package for a numpy.memmap-based reader.
+ */
+class SampleSetWriter {
+public:
+
+    /**
+     *  @brief Open a new file for writing, truncating any existing file
+     *
+     *  @param[in] filename      Path of the file to create
+     *  @param[in] parameterDim  Number of nonlinear parameters per sample; all
+     *                           appended catalogs must match.
+     */
+    SampleSetWriter(std::string const & filename, int parameterDim);
+
+    // Noncopyable: the writer owns the underlying stream.
+    SampleSetWriter(SampleSetWriter const &) = delete;
+    SampleSetWriter & operator=(SampleSetWriter const &) = delete;
+
+    /**
+     *  @brief Append one sample set as a new block
+     *
+     *  The catalog schema must contain the "weight", "objective", "proposal",
+     *  and "parameters" fields added by AdaptiveImportanceSampler.
+     *
+     *  @param[in] samples  Catalog of samples to append
+     *  @param[in] id       Identifier stored with the block (e.g. a source ID);
+     *                      if negative, a running block counter is used.
+     */
+    void append(afw::table::BaseCatalog const & samples, std::int64_t id=-1);
+
+    /// @brief Return the parameter dimension declared in the file header
+    int getParameterDim() const { return _parameterDim; }
+
+    /// @brief Return the number of blocks appended so far
+    std::int64_t getBlockCount() const { return _blockCount; }
+
+    /// @brief Flush and close the file; called automatically by the destructor
+    void close();
+
+    ~SampleSetWriter();
+
+private:
+    int _parameterDim;
+    std::int64_t _blockCount;
+    std::ofstream _stream;
+};
+
+}}} // namespace lsst::meas::modelfit
+
+#endif // !LSST_MEAS_MODELFIT_SampleSetFile_h_INCLUDED
@@ -38,6 +38,7 @@ namespace lsst { namespace meas { namespace modelfit {
 class TruncatedGaussianSampler;
 class TruncatedGaussianEvaluator;
 class TruncatedGaussianLogEvaluator;
+class TruncatedGaussianBuilder;
 
 /**
  *  @brief Represents a multidimensional Gaussian function truncated at zero
@@ -231,14 +232,55 @@ private:
 
     friend class TruncatedGaussianSampler;
     friend class TruncatedGaussianLogEvaluator;
+    friend class TruncatedGaussianBuilder;
 
     class Impl;
 
+    // Implementation shared by fromSeriesParameters() and TruncatedGaussianBuilder;
+    // takes the eigen-decomposition H = V S V^T instead of computing it.
+    static TruncatedGaussian _fromSeriesParameters(
+        Scalar q0, Vector const & gradient, Matrix const & hessian,
+        Vector const & s, Matrix const & v
+    );
+
     explicit TruncatedGaussian(std::shared_ptr<Impl> impl) : _impl(impl) {}
 
     std::shared_ptr<Impl> _impl;
 };
 
+/**
+ *  @brief Helper class for repeatedly constructing series-form TruncatedGaussians
+ *
+ *  Each call to TruncatedGaussian::fromSeriesParameters() performs an eigen-analysis
+ *  of the Hessian, but objective code that evaluates many nearby sample points often
+ *  passes the same Hessian repeatedly while only the gradient changes.  A builder
+ *  keeps the decomposition of the last Hessian it was given and reuses it whenever
+ *  the same matrix (by exact element-wise comparison) is passed again, so those
+ *  calls only pay for the work that actually depends on the gradient.
+ *
+ *  A builder holds mutable state, so unlike TruncatedGaussian itself it must not
+ *  be shared between threads; give each thread its own.
+ */
+class TruncatedGaussianBuilder {
+public:
+
+    /// Construct a builder for the given dimensionality (at most 2, as with TruncatedGaussian)
+    explicit TruncatedGaussianBuilder(int dim);
+
+    /// @brief Equivalent to TruncatedGaussian::fromSeriesParameters, but reuses the
+    ///        cached Hessian decomposition when the Hessian has not changed.
+    TruncatedGaussian operator()(Scalar q0, Vector const & gradient, Matrix const & hessian);
+
+    /// @brief Return the dimensionality of the TruncatedGaussians this builder constructs
+    int getDim() const { return _hessian.rows(); }
+
+private:
+    bool _valid;      // whether _s, _v hold the decomposition of _hessian
+    Matrix _hessian;  // Hessian from the most recent call
+    Vector _s;        // cached eigenvalues
+    Matrix _v;        // cached eigenvectors
+};
+
 /**
  *  @brief Helper class for evaluating the -log of a TruncatedGaussian
  */
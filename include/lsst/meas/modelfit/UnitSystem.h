@@ -90,10 +90,48 @@ struct LocalUnitTransform {
     LocalUnitTransform(geom::Point2D const& sourcePixel, UnitSystem const& source,
                        UnitSystem const& destination);
 
+    /// Construct from an already-linearized geometric transform and flux scaling.
+    LocalUnitTransform(geom::AffineTransform const& geometric_, double flux_)
+            : geometric(geometric_), flux(flux_), sb(flux / geometric.getLinear().computeDeterminant()) {}
+
     /// Construct an identity transform for both geometry and flux.
     LocalUnitTransform() : geometric(), flux(1.0), sb(1.0) {}
 };
 
+/**
+ *  @brief An exposure-scoped cache for constructing per-source fit unit systems and transforms.
+ *
+ *  The measurement-system pieces shared by every source on an exposure (the validated
+ *  PhotoCalib and its zero-magnitude flux) are computed once at construction.  Per-source
+ *  standard fit systems and fitSys-to-measSys transforms are then produced by linearizing
+ *  only the measurement Wcs at the source position, instead of constructing and linearizing
+ *  a full Wcs-pair transform for every source as the LocalUnitTransform constructor does.
+ */
+class UnitTransformCache {
+public:
+    explicit UnitTransformCache(UnitSystem const& measSys);
+
+    /// Return the measurement system passed to the constructor (with validated PhotoCalib).
+    UnitSystem const& getMeasSys() const { return _measSys; }
+
+    /**
+     *  Construct the standard fit UnitSystem for a source, equivalent to
+     *  UnitSystem(position, measSys.photoCalib, flux) but using the cached photometric zero point.
+     */
+    UnitSystem makeFitSys(geom::SpherePoint const& position, Scalar flux) const;
+
+    /**
+     *  Construct the transform from a fit system made by makeFitSys to the measurement system,
+     *  composing separate linearizations of the two Wcs at the source position.
+     */
+    LocalUnitTransform makeFitSysToMeasSys(geom::SpherePoint const& position,
+                                           UnitSystem const& fitSys) const;
+
+private:
+    UnitSystem _measSys;
+    double _zeroFlux;  // instFlux at zero magnitude of the measurement PhotoCalib
+};
+
 }  // namespace modelfit
 }  // namespace meas
 }  // namespace lsst
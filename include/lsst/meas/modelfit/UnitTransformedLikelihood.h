@@ -57,8 +57,40 @@ public:
     LSST_CONTROL_FIELD(weightsMultiplier, double,
                        "Scaling factor to apply to weights.");
 
-    explicit UnitTransformedLikelihoodControl(bool usePixelWeights_=false, double weightsMultiplier_=1.0)
-        : usePixelWeights(usePixelWeights_), weightsMultiplier(weightsMultiplier_) {}
+    LSST_CONTROL_FIELD(nThreads, int,
+                       "Number of threads used to evaluate model matrix tiles (1 = serial).  "
+                       "Multi-epoch fits always have one tile per epoch to distribute; "
+                       "single-epoch fits only benefit when blockSize tiling is enabled.");
+
+    LSST_CONTROL_FIELD(blockSize, int,
+                       "Maximum number of pixels a model-matrix tile may contain (0 = process all "
+                       "of an epoch's pixels as a single tile).  Smaller tiles keep the scratch "
+                       "block used by computeFitStatistics cache-sized on very large footprints.");
+
+    LSST_CONTROL_FIELD(tileSkipThreshold, double,
+                       "Relative profile level below which a tile is skipped entirely when "
+                       "accumulating fit statistics (0 = never skip).  The test uses a circular "
+                       "Gaussian bound on the PSF-convolved model ellipse, so it is approximate "
+                       "and should be kept well below the noise level; it has no effect unless "
+                       "blockSize > 0.");
+
+    LSST_CONTROL_FIELD(binFactor, int,
+                       "If greater than one, combine the pixels outside binCoreRadius into "
+                       "binFactor x binFactor pseudo-pixels, each holding the inverse-variance "
+                       "weighted mean of its pixels' data, the variance of that mean, and their "
+                       "weighted centroid as its coordinates.  This bounds the data vector size "
+                       "for very large footprints at the cost of assuming the model is smooth "
+                       "across a bin in the outskirts; it applies only to single-epoch "
+                       "likelihoods.  One (the default) keeps every pixel at full resolution.");
+
+    LSST_CONTROL_FIELD(binCoreRadius, double,
+                       "Radius in pixels around the fit center within which pixels are never "
+                       "binned (only used when binFactor > 1).");
+
+    explicit UnitTransformedLikelihoodControl(bool usePixelWeights_=false, double weightsMultiplier_=1.0,
+                                              int nThreads_=1)
+        : usePixelWeights(usePixelWeights_), weightsMultiplier(weightsMultiplier_), nThreads(nThreads_),
+          blockSize(0), tileSkipThreshold(0.0), binFactor(1), binCoreRadius(32.0) {}
 
 };
 
@@ -109,6 +141,16 @@ public:
         bool doApplyWeights=true
     ) const override;
 
+    /**
+     *  @copydoc Likelihood::computeFitStatistics
+     *
+     *  This implementation accumulates the terms one epoch at a time from a scratch block
+     *  sized to the largest epoch, instead of materializing the full model matrix.
+     */
+    FitStatistics computeFitStatistics(
+        ndarray::Array<Scalar const,1,1> const & nonlinear
+    ) const override;
+
     /**
      * @brief Initialize a UnitTransformedLikelihood with data from multiple exposures.
      *
@@ -151,6 +193,27 @@ public:
         UnitTransformedLikelihoodControl const & ctrl
     );
 
+    /**
+     * @brief Initialize a UnitTransformedLikelihood that shares pixel data with an existing one.
+     *
+     * @param[in] model             Object that defines the model to fit and its parameters.
+     * @param[in] fixed             Model parameters that are held fixed.
+     * @param[in] other             Likelihood to share pixel data with.
+     *
+     * The new likelihood reuses (via shallow ndarray assignment) the flattened data,
+     * variance, and weight arrays and the per-epoch pixel coordinates of `other`
+     * instead of re-extracting them from the exposure; only the shapelet matrix
+     * builders, which depend on the model's basis, are rebuilt.  This is only valid
+     * when the new likelihood would otherwise be constructed over the same pixel
+     * region, unit systems, and PSF with the same control settings as `other`, with
+     * only the model changed; the caller is responsible for checking that.
+     */
+    UnitTransformedLikelihood(
+        std::shared_ptr<Model> model,
+        ndarray::Array<Scalar const,1,1> const & fixed,
+        UnitTransformedLikelihood const & other
+    );
+
     virtual ~UnitTransformedLikelihood();
 
 private:
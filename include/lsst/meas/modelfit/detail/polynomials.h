@@ -32,6 +32,12 @@ namespace lsst { namespace meas { namespace modelfit { namespace detail {
  * Class that computes rows of the Vandermonde matrix and related matrices;
  * the dot product of these row vectors with the polynomial coefficient
  * vectors evaluates the polynomial (or computes a derivative).
+ *
+ * The row computations are defined inline with the degree as a compile-time
+ * constant, so the fixed-trip-count loops fully unroll and a call like
+ * coeffs.dot(Vandermonde<4>::eval(x)) compiles to straight-line multiply-add
+ * code with no runtime vector construction; these sit under the softened
+ * prior ramps, which are evaluated per sample.
 */
 template <int N>
 class Vandermonde {
@@ -40,19 +46,49 @@ public:
 
     /// Return a row vector that product with a polynomial coefficient vector[
     /// evaluates the polynomial at x.
-    static RowVector eval(double x);
+    static RowVector eval(double x) {
+        RowVector z = RowVector::Zero();
+        double y = 1.0;
+        for (int i = 0; i < N; ++i, y *= x) {
+            z[i] = y;
+        }
+        return z;
+    }
 
     /// Return a row vector whose product with a polynomial coefficient vector
     /// evaluates the first derivative at x.
-    static RowVector differentiate1(double x);
+    static RowVector differentiate1(double x) {
+        RowVector z = RowVector::Zero();
+        double y = 1.0;
+        for (int i = 1; i < N; ++i, y *= x) {
+            z[i] = i*y;
+        }
+        return z;
+    }
 
     /// Return a row vector whose product with a polynomial coefficient vector
     /// evaluates the second derivative at x.
-    static RowVector differentiate2(double x);
+    static RowVector differentiate2(double x) {
+        RowVector z = RowVector::Zero();
+        double y = 1.0;
+        for (int i = 2; i < N; ++i, y *= x) {
+            z[i] = i*(i-1)*y;
+        }
+        return z;
+    }
 
     /// Return a row vector whose product with a polynomial coefficient vector
     /// computes the integral of p(x) x^m dx from x0 to x1
-    static RowVector moment(double x0, double x1, int m=0);
+    static RowVector moment(double x0, double x1, int m=0) {
+        RowVector z = RowVector::Zero();
+        double y0 = x0;
+        double y1 = x1;
+        for (int j = 0; j < m; ++j, y0 *= x0, y1 *= x1);
+        for (int i = 0; i < N; ++i, y0 *= x0, y1 *= x1) {
+            z[i] = (y1 / (i+m+1)) - (y0 / (i+m+1));
+        }
+        return z;
+    }
 
 };
 
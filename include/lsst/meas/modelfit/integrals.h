@@ -44,6 +44,16 @@ namespace lsst { namespace meas { namespace modelfit { namespace detail {
  */
 double phid(double z);
 
+/**
+ *  @brief Accuracy tiers for bvnu
+ *
+ *  FULL reproduces the original Genz quadrature table selection (absolute error ~1E-15).
+ *  REDUCED drops to the next-smaller quadrature table for the same correlation, trading
+ *  roughly half the quadrature points for an absolute error of order 1E-7, which is far
+ *  below the noise floor of any photometric likelihood.
+ */
+enum class BvnuAccuracy { FULL, REDUCED };
+
 /**
  *  @brief Compute bivariate normal probabilities
  *
@@ -66,7 +76,21 @@ double phid(double z);
  *  Most of the time, this function should be called via the methods in the TruncatedGaussian class;
  *  it is exposed publically only for testing purposes.
  */
-double bvnu(double h, double k, double rho);
+double bvnu(double h, double k, double rho, BvnuAccuracy accuracy=BvnuAccuracy::FULL);
+
+/**
+ *  @brief Compute bivariate normal probabilities for arrays of arguments
+ *
+ *  Equivalent to calling the scalar bvnu for each element; all input arrays and the
+ *  output array must have the same size.
+ */
+void bvnu(
+    ndarray::Array<double const,1,1> const & h,
+    ndarray::Array<double const,1,1> const & k,
+    ndarray::Array<double const,1,1> const & rho,
+    ndarray::Array<double,1,1> const & out,
+    BvnuAccuracy accuracy=BvnuAccuracy::FULL
+);
 
 }}}} // namespace lsst::meas::modelfit::detail
 
@@ -24,6 +24,8 @@
 #ifndef LSST_MEAS_MODELFIT_optimizer_h_INCLUDED
 #define LSST_MEAS_MODELFIT_optimizer_h_INCLUDED
 
+#include "Eigen/Eigenvalues"
+
 #include "ndarray.h"
 
 #include "lsst/base.h"
@@ -37,6 +39,7 @@ namespace lsst { namespace meas { namespace modelfit {
 class Likelihood;
 class Prior;
 class Optimizer;
+class OptimizerIterationBuffer;
 
 /**
  *  @brief Base class for objective functions for Optimizer
@@ -52,13 +55,33 @@ public:
      *
      *  Most fitting problems that can be formulated in terms of
      *  (multi-shapelet) Models, Likelihoods, and Priors can just use this
-     *  Objective.  The returned Objective relies on numerical derivatives,
-     *  however, so simple problems where analytic derivatives are easy to
-     *  implement may merit a custom OptimizerObjective.
+     *  Objective.  By default the returned Objective relies on the Optimizer's
+     *  numerical derivatives, so simple problems where analytic derivatives
+     *  are easy to implement may merit a custom OptimizerObjective.
+     *
+     *  When doComputeJacobian is true, the returned Objective implements
+     *  differentiateResiduals itself: the amplitude block of the Jacobian is
+     *  computed analytically (the residuals are linear in the amplitudes, with
+     *  the model matrix as the derivative), and only the nonlinear parameters
+     *  are differenced numerically - each with a single model-matrix
+     *  evaluation, since the data term cancels in the difference.  For a model
+     *  with m amplitudes this saves m full model evaluations per optimizer
+     *  iteration relative to the fully-numeric fallback.  The numeric step for
+     *  the nonlinear block is scale-invariant but fixed (it cannot track the
+     *  Optimizer's trust radius the way the fallback does), so results differ
+     *  slightly from the default path; hence this is opt-in.
+     *
+     *  The returned Objective also memoizes its most recent residual
+     *  evaluations: the incoming parameter vector is compared against the last
+     *  few evaluated ones, and the cached residuals are returned on an exact
+     *  match, short-circuiting the duplicate evaluations produced when
+     *  rejected trust-region steps revisit numerically identical points.  The
+     *  hit rate is observable via getMemoCallCount() and getMemoHitCount().
      */
     static std::shared_ptr<OptimizerObjective> makeFromLikelihood(
         std::shared_ptr<Likelihood> likelihood,
-        std::shared_ptr<Prior> prior = std::shared_ptr<Prior>()
+        std::shared_ptr<Prior> prior = std::shared_ptr<Prior>(),
+        bool doComputeJacobian = false
     );
 
     /**
@@ -126,6 +149,28 @@ public:
     }
 
 
+    /**
+     *  @brief Return an independent copy of the Objective, or null if copying is unsupported.
+     *
+     *  The returned copy is only required to support computeResiduals calls concurrent with
+     *  the original; it may share state (e.g. a prior) that computeResiduals never touches.
+     *  The Optimizer uses these copies to evaluate numeric-derivative columns in parallel
+     *  (see OptimizerControl::numDiffThreads); the default implementation returns null,
+     *  which disables that parallelism.
+     */
+    virtual std::shared_ptr<OptimizerObjective> clone() const { return nullptr; }
+
+    //@{
+    /**
+     *  Counters for the recent-evaluation memo used by objectives returned by
+     *  makeFromLikelihood: the total number of computeResiduals calls seen, and
+     *  the number served from the memo without re-evaluating the likelihood.
+     *  The default implementations return zero (no memo).
+     */
+    virtual std::size_t getMemoCallCount() const { return 0; }
+    virtual std::size_t getMemoHitCount() const { return 0; }
+    //@}
+
     /**
      *  Return true if the Objective has a Bayesian prior as well as a likelihood.
      *
@@ -221,6 +266,12 @@ public:
         "step size (in units of trust radius) used for numerical derivatives (added to relative step)"
     );
 
+    LSST_CONTROL_FIELD(
+        numDiffThreads, int,
+        "number of threads used to evaluate numeric-derivative columns concurrently; values > 1 "
+        "require an objective whose clone() method is implemented, and are ignored otherwise"
+    );
+
     LSST_CONTROL_FIELD(
         stepAcceptThreshold, double,
         "steps with reduction ratio greater than this are accepted"
@@ -261,6 +312,14 @@ public:
         "value passed as the tolerance to solveTrustRegion"
     );
 
+    LSST_CONTROL_FIELD(
+        useSteihaugCG, bool,
+        "solve the trust region subproblem with truncated conjugate gradients (Steihaug-Toint) "
+        "instead of the dense eigensolver; the subproblem solution is approximate, but only "
+        "Hessian-vector products are needed, so steps scale much better with parameter "
+        "dimension (recommended for the larger PSF-fitting problems)"
+    );
+
     LSST_CONTROL_FIELD(
         maxInnerIterations, int,
         "maximum number of iterations (i.e. function evaluations and trust region subproblems) per step"
@@ -281,6 +340,7 @@ public:
         minTrustRadiusThreshold(1E-5),
         gradientThreshold(1E-5),
         numDiffRelStep(0.0), numDiffAbsStep(0.0), numDiffTrustRadiusStep(0.1),
+        numDiffThreads(1),
         stepAcceptThreshold(0.0),
         trustRegionInitialSize(1.0),
         trustRegionGrowReductionRatio(0.75),
@@ -289,6 +349,7 @@ public:
         trustRegionShrinkReductionRatio(0.25),
         trustRegionShrinkFactor(1.0/3.0),
         trustRegionSolverTolerance(1E-8),
+        useSteihaugCG(false),
         maxInnerIterations(20),
         maxOuterIterations(500),
         doSaveIterations(false)
@@ -353,6 +414,184 @@ public:
     ArrayKey derivatives;
 };
 
+/**
+ *  @brief Preallocated ring-buffer recorder for optimizer iteration history.
+ *
+ *  OptimizerHistoryRecorder appends a BaseCatalog record on every optimizer step,
+ *  with a per-record allocation and key-by-key copies in the hot loop.  This
+ *  recorder instead writes each step into a preallocated ring of flat arrays,
+ *  overwriting the oldest entries once capacity is reached, and converts to a
+ *  BaseCatalog only on demand via asCatalog() - cheap enough to leave history
+ *  capture enabled in production.
+ */
+class OptimizerIterationBuffer {
+public:
+
+    /**
+     *  @param[in] parameterSize      Number of parameters in the fits to be recorded.
+     *  @param[in] capacity           Number of steps retained; once the buffer is full,
+     *                                the oldest steps are overwritten.
+     *  @param[in] doSaveDerivatives  Whether to record the gradient and Hessian at each
+     *                                accepted step.
+     */
+    OptimizerIterationBuffer(int parameterSize, int capacity, bool doSaveDerivatives=true);
+
+    /// Record the optimizer's current state; called by Optimizer::step and Optimizer::run.
+    void apply(int outerIterCount, int innerIterCount, Optimizer const & optimizer);
+
+    /// Forget all recorded steps without releasing storage.
+    void clear() { _size = 0; _next = 0; }
+
+    int getParameterSize() const { return static_cast<int>(_parameters.getSize<1>()); }
+
+    int getCapacity() const { return static_cast<int>(_parameters.getSize<0>()); }
+
+    /// Number of steps currently held (at most the capacity).
+    int getSize() const { return _size; }
+
+    /**
+     *  Copy the recorded steps (oldest first) into a new BaseCatalog.
+     *
+     *  The catalog's schema has the same fields as one built by OptimizerHistoryRecorder,
+     *  so an OptimizerHistoryRecorder constructed from that schema can be used to unpack
+     *  the derivatives.  Derivatives of rejected steps are set to NaN.
+     */
+    afw::table::BaseCatalog asCatalog() const;
+
+private:
+    int _size;
+    int _next;
+    std::vector<int> _outer;
+    std::vector<int> _inner;
+    std::vector<int> _state;
+    std::vector<Scalar> _objective;
+    std::vector<Scalar> _prior;
+    std::vector<Scalar> _trust;
+    ndarray::Array<Scalar,2,2> _parameters;   // shape (capacity, parameterSize)
+    ndarray::Array<Scalar,2,2> _derivatives;  // shape (capacity, n + n*(n+1)/2); empty if not saved
+};
+
+/**
+ *  @brief Fixed-dimension specialization of the trust region subproblem solver.
+ *
+ *  This implements the same factor/solve split as TrustRegionSolver (see its
+ *  documentation), but with Eigen::Matrix<Scalar,N,N> storage, so all of the
+ *  per-solve linear algebra is stack-allocated and fully unrolled at compile
+ *  time instead of going through dynamic-size Eigen objects and their heap
+ *  temporaries; for N <= 3 the factorization also uses Eigen's closed-form
+ *  computeDirect eigensolver.  TrustRegionSolver dispatches to an instantiated
+ *  specialization automatically when the problem dimension matches, so callers
+ *  never need to name this class directly; the CModel stage fits (3 nonlinear
+ *  parameters plus one amplitude) land on the N=3 and N=4 instantiations.
+ */
+template <int N>
+class FixedDimTrustRegionSolver {
+public:
+
+    FixedDimTrustRegionSolver() : _gNormInf(0.0), _mu(0.0), _muValid(false) {}
+
+    /// See TrustRegionSolver::setProblem; F must have shape (N,N) and g shape (N).
+    void setProblem(
+        ndarray::Array<Scalar const,2,1> const & F,
+        ndarray::Array<Scalar const,1,1> const & g
+    );
+
+    /// See TrustRegionSolver::solve.
+    void solve(ndarray::Array<Scalar,1,1> const & x, double r, double tolerance) const;
+
+private:
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix<Scalar,N,N>> _eigh;
+    Eigen::Matrix<Scalar,N,1> _qtg;
+    double _gNormInf;
+    mutable double _mu;      // warm-start estimate of the constraint multiplier
+    mutable bool _muValid;
+};
+
+/**
+ *  @brief Stateful solver for the trust region subproblem.
+ *
+ *  This solves the same constrained quadratic problem as solveTrustRegion (see
+ *  its documentation for the mathematical definition), but splits the work into
+ *  a factorization step (setProblem) and a solve step so the eigendecomposition
+ *  of the Hessian can be reused when the same problem is solved repeatedly at
+ *  different radii - which is exactly what happens across the inner iterations
+ *  of an Optimizer step, where the Hessian is fixed while the trust radius
+ *  shrinks.  The solver also remembers the Lagrange multiplier from the last
+ *  constrained solve and uses it to warm-start the next one, which saves
+ *  secular-equation iterations when consecutive problems are similar (e.g.
+ *  across accepted optimizer steps).
+ *
+ *  Problems whose dimension matches an instantiated FixedDimTrustRegionSolver
+ *  are routed to it transparently, so the small stage fits get fixed-size
+ *  linear algebra without any changes on the caller's side.
+ */
+class TrustRegionSolver {
+public:
+
+    TrustRegionSolver() : _dim(0), _gNormInf(0.0), _mu(0.0), _muValid(false) {}
+
+    /**
+     *  Factor a new Hessian/gradient pair, invalidating any previous problem.
+     *
+     *  @param[in] F   Symmetric matrix defining the quadratic term, shape (n,n).
+     *  @param[in] g   Vector defining the linear term, shape (n).
+     *
+     *  The warm-start multiplier from previous solves is retained, as it
+     *  remains a useful initial guess when the new problem is close to the
+     *  old one.
+     */
+    void setProblem(
+        ndarray::Array<Scalar const,2,1> const & F,
+        ndarray::Array<Scalar const,1,1> const & g
+    );
+
+    /**
+     *  Solve the trust region subproblem at the given radius.
+     *
+     *  May be called any number of times after setProblem, with different radii,
+     *  without refactoring the Hessian.
+     *
+     *  @param[out] x          Output solution vector, shape (n).
+     *  @param[in]  r          Trust region radius.
+     *  @param[in]  tolerance  See solveTrustRegion.
+     */
+    void solve(ndarray::Array<Scalar,1,1> const & x, double r, double tolerance) const;
+
+private:
+    int _dim;                // dimension of the current problem, for dispatching
+    FixedDimTrustRegionSolver<3> _fixed3;
+    FixedDimTrustRegionSolver<4> _fixed4;
+    Eigen::SelfAdjointEigenSolver<Matrix> _eigh;
+    Vector _qtg;
+    double _gNormInf;
+    mutable double _mu;      // warm-start estimate of the constraint multiplier
+    mutable bool _muValid;
+};
+
+/**
+ *  @brief Compact record of an Optimizer's state, usable to warm-start a later fit.
+ *
+ *  A checkpoint captures the parameter vector, trust region radius, and full
+ *  Hessian estimate (including the SR1 correction term) at the point a fit
+ *  ended.  Passing it to the warm-start Optimizer constructor when refitting
+ *  the same (or a slightly perturbed) problem lets the optimizer resume with
+ *  the curvature information it had already accumulated, instead of starting
+ *  from scratch with a fresh trust region and a zero SR1 term.
+ */
+struct OptimizerCheckpoint {
+
+    /// Parameter vector at the checkpoint, shape (parameterSize).
+    ndarray::Array<Scalar,1,1> parameters;
+
+    /// Trust region radius at the checkpoint (<= 0 means "use the configured initial size").
+    Scalar trustRadius;
+
+    /// Hessian estimate at the checkpoint, shape (parameterSize, parameterSize); may be empty.
+    ndarray::Array<Scalar,2,2> hessian;
+
+    OptimizerCheckpoint() : trustRadius(0.0) {}
+};
+
 /**
  *  @brief A numerical optimizer customized for least-squares problems with Bayesian priors
  *
@@ -429,6 +668,20 @@ public:
         Control const & ctrl
     );
 
+    /**
+     *  Construct an Optimizer warm-started from a checkpoint of a previous fit.
+     *
+     *  The initial parameters are taken from the checkpoint.  If the checkpoint's trust radius
+     *  is positive it replaces the configured trustRegionInitialSize, and if its Hessian is
+     *  non-empty the SR1 correction term is seeded so the initial Hessian matches the
+     *  checkpointed estimate instead of just the Gauss-Newton (+ prior) term.
+     */
+    Optimizer(
+        std::shared_ptr<Objective const> objective,
+        OptimizerCheckpoint const & checkpoint,
+        Control const & ctrl
+    );
+
     std::shared_ptr<Objective const> getObjective() const { return _objective; }
 
     Control const & getControl() const { return _ctrl; }
@@ -439,12 +692,16 @@ public:
         return _stepImpl(0, &recorder, &history);
     }
 
+    bool step(OptimizerIterationBuffer & buffer) { return _stepImpl(0, NULL, NULL, &buffer); }
+
     int run() { return _runImpl(); }
 
     int run(HistoryRecorder const & recorder, afw::table::BaseCatalog & history) {
         return _runImpl(&recorder, &history);
     }
 
+    int run(OptimizerIterationBuffer & buffer) { return _runImpl(NULL, NULL, &buffer); }
+
     int getState() const { return _state; }
 
     Scalar getObjectiveValue() const { return _current.objectiveValue; }
@@ -457,6 +714,11 @@ public:
 
     ndarray::Array<Scalar const,2,2> getHessian() const { return _hessian; }
 
+    double getTrustRadius() const { return _trustRadius; }
+
+    /// Return a (deep-copied) checkpoint of the current state for later warm starts.
+    OptimizerCheckpoint getCheckpoint() const;
+
     /// Remove the symmetric-rank-1 secant term from the Hessian, making it just (J^T J)
     void removeSR1Term();
 
@@ -474,19 +736,27 @@ private:
     };
 
     friend class OptimizerHistoryRecorder;
+    friend class OptimizerIterationBuffer;
 
     bool _stepImpl(
         int outerIterCount,
         HistoryRecorder const * recorder=NULL,
-        afw::table::BaseCatalog * history=NULL
+        afw::table::BaseCatalog * history=NULL,
+        OptimizerIterationBuffer * buffer=NULL
     );
 
-    int _runImpl(HistoryRecorder const * recorder=NULL, afw::table::BaseCatalog * history=NULL);
+    int _runImpl(
+        HistoryRecorder const * recorder=NULL,
+        afw::table::BaseCatalog * history=NULL,
+        OptimizerIterationBuffer * buffer=NULL
+    );
 
     void _computeDerivatives();
 
     int _state;
     std::shared_ptr<Objective const> _objective;
+    // per-thread objective copies for parallel numeric differentiation; empty when serial
+    std::vector<std::shared_ptr<Objective const>> _numDiffObjectives;
     Control _ctrl;
     double _trustRadius;
     IterationData _current;
@@ -498,6 +768,7 @@ private:
     Matrix _sr1b;
     Vector _sr1v;
     Vector _sr1jtr;
+    TrustRegionSolver _trSolver;
 };
 
 /**
@@ -521,6 +792,28 @@ void solveTrustRegion(
     double r, double tolerance
 );
 
+/**
+ *  @brief Approximately solve the trust region subproblem with truncated conjugate gradients.
+ *
+ *  This solves the same constrained quadratic problem as solveTrustRegion using the
+ *  Steihaug-Toint method: conjugate-gradient iterations on @f$F x = -g@f$ are started
+ *  from @f$x=0@f$ and truncated at the trust region boundary when an iterate leaves
+ *  the ball or a direction of nonpositive curvature is encountered.  The solution is
+ *  approximate (it is only guaranteed to do at least as well as the Cauchy point),
+ *  but only Hessian-vector products are required, so the cost per iteration is
+ *  @f$O(n^2)@f$ rather than the @f$O(n^3)@f$ eigendecomposition of the near-exact
+ *  solver, which matters for the 20-40 parameter problems produced by multi-component
+ *  PSF fitting.
+ *
+ *  The tolerance parameter sets the relative residual norm @f$\|F x + g\|/\|g\|@f$
+ *  at which the iteration stops when the solution lies inside the constraint.
+ */
+void solveTrustRegionSteihaug(
+    ndarray::Array<Scalar,1,1> const & x,
+    ndarray::Array<Scalar const,2,1> const & F, ndarray::Array<Scalar const,1,1> const & g,
+    double r, double tolerance
+);
+
 }}} // namespace lsst::meas::modelfit
 
 #endif // !LSST_MEAS_MODELFIT_optimizer_h_INCLUDED
@@ -0,0 +1,57 @@
+// -*- lsst-c++ -*-
+/*
+ * LSST Data Management System
+ * Copyright 2008-2013 LSST Corporation.
+ *
+ * This product includes software developed by the
+ * LSST Project (http://www.lsst.org/).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the LSST License Statement and
+ * the GNU General Public License along with this program.  If not,
+ * see <http://www.lsstcorp.org/LegalNotices/>.
+ */
+
+#ifndef LSST_MEAS_MODELFIT_splitRandom_h_INCLUDED
+#define LSST_MEAS_MODELFIT_splitRandom_h_INCLUDED
+
+#include <cstdint>
+#include <memory>
+
+#include "lsst/afw/math/Random.h"
+
+namespace lsst { namespace meas { namespace modelfit {
+
+/**
+ *  @brief Derive an independent child random number generator from a parent.
+ *
+ *  The child's seed is produced by mixing the parent's original seed with the
+ *  given stream indices through the SplitMix64 finalizer, a counter-based
+ *  construction whose outputs are well distributed even for consecutive
+ *  inputs.  The parent's state is not consumed, so the mapping from
+ *  (parent seed, index1, index2) to child stream is reproducible regardless
+ *  of how much of the parent stream has already been used, and distinct index
+ *  pairs yield statistically independent streams.  Using indices with stable
+ *  meanings (e.g. a source id and a chain id) makes parallel sampling
+ *  deterministic under any thread count or work distribution.
+ *
+ *  The child uses the same underlying algorithm as the parent.
+ */
+std::shared_ptr<afw::math::Random> splitRandom(
+    afw::math::Random const & parent,
+    std::uint64_t index1,
+    std::uint64_t index2 = 0
+);
+
+}}} // namespace lsst::meas::modelfit
+
+#endif // !LSST_MEAS_MODELFIT_splitRandom_h_INCLUDED
@@ -21,6 +21,7 @@
 #
 from .version import *
 from .common import *
+from .sampleSetFile import *
 
 from ._modelfitLib import *
 from .priors import *
@@ -26,6 +26,8 @@
 
 #include "lsst/pex/config/python.h"
 #include "lsst/meas/modelfit/AdaptiveImportanceSampler.h"
+#include "lsst/meas/modelfit/SampleSetFile.h"
+#include "lsst/meas/modelfit/splitRandom.h"
 #include "lsst/afw/table/BaseRecord.h"
 #include "lsst/afw/table/BaseTable.h"
 #include "lsst/afw/table/Catalog.h"
@@ -41,8 +43,19 @@ using PyImportanceSamplerControl =
         py::class_<ImportanceSamplerControl, std::shared_ptr<ImportanceSamplerControl>>;
 using PyAdaptiveImportanceSampler =
         py::class_<AdaptiveImportanceSampler, std::shared_ptr<AdaptiveImportanceSampler>, Sampler>;
+using PySampleSetWriter = py::class_<SampleSetWriter, std::shared_ptr<SampleSetWriter>>;
 
 void wrapAdaptiveImportanceSampler(lsst::cpputils::python::WrapperCollection &wrappers) {
+    wrappers.wrap([](auto &mod) {
+        mod.def("splitRandom", &splitRandom, "parent"_a, "index1"_a, "index2"_a = 0);
+    });
+    wrappers.wrapType(PySampleSetWriter(wrappers.module, "SampleSetWriter"), [](auto &mod, auto &cls) {
+        cls.def(py::init<std::string const &, int>(), "filename"_a, "parameterDim"_a);
+        cls.def("append", &SampleSetWriter::append, "samples"_a, "id"_a = -1);
+        cls.def("getParameterDim", &SampleSetWriter::getParameterDim);
+        cls.def("getBlockCount", &SampleSetWriter::getBlockCount);
+        cls.def("close", &SampleSetWriter::close);
+    });
     wrappers.wrapType(PyImportanceSamplerControl(wrappers.module, "ImportanceSamplerControl"), [](auto &mod, auto &cls) {
         cls.def(py::init<>());
         LSST_DECLARE_CONTROL_FIELD(cls, ImportanceSamplerControl, nSamples);
@@ -51,6 +64,9 @@ void wrapAdaptiveImportanceSampler(lsst::cpputils::python::WrapperCollection &wr
         LSST_DECLARE_CONTROL_FIELD(cls, ImportanceSamplerControl, tau2);
         LSST_DECLARE_CONTROL_FIELD(cls, ImportanceSamplerControl, targetPerplexity);
         LSST_DECLARE_CONTROL_FIELD(cls, ImportanceSamplerControl, maxRepeat);
+        LSST_DECLARE_CONTROL_FIELD(cls, ImportanceSamplerControl, targetEffectiveSampleSizeFraction);
+        LSST_DECLARE_CONTROL_FIELD(cls, ImportanceSamplerControl, nThreads);
+        LSST_DECLARE_CONTROL_FIELD(cls, ImportanceSamplerControl, nChains);
 
         PyAdaptiveImportanceSampler clsAdaptiveImportanceSampler(mod, "AdaptiveImportanceSampler");
         clsAdaptiveImportanceSampler.def(py::init<afw::table::Schema &, std::shared_ptr<afw::math::Random>,
@@ -61,6 +77,9 @@ void wrapAdaptiveImportanceSampler(lsst::cpputils::python::WrapperCollection &wr
                                          &AdaptiveImportanceSampler::computeNormalizedPerplexity);
         clsAdaptiveImportanceSampler.def("computeEffectiveSampleSizeFraction",
                                          &AdaptiveImportanceSampler::computeEffectiveSampleSizeFraction);
+        clsAdaptiveImportanceSampler.def("setSampleWriter", &AdaptiveImportanceSampler::setSampleWriter,
+                                         "writer"_a);
+        clsAdaptiveImportanceSampler.def("getSampleWriter", &AdaptiveImportanceSampler::getSampleWriter);
     });
 }
 
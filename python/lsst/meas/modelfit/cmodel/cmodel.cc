@@ -22,6 +22,7 @@
  */
 
 #include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
 #include "lsst/cpputils/python.h"
 
 #include "ndarray/pybind11.h"
@@ -41,6 +42,9 @@ using PyCModelStageControl = py::class_<CModelStageControl, std::shared_ptr<CMod
 using PyCModelControl = py::class_<CModelControl, std::shared_ptr<CModelControl>>;
 using PyCModelStageResult = py::class_<CModelStageResult, std::shared_ptr<CModelStageResult>>;
 using PyCModelResult = py::class_<CModelResult, std::shared_ptr<CModelResult>>;
+using PyCModelStageStats = py::class_<CModelStageStats, std::shared_ptr<CModelStageStats>>;
+using PyCModelStats = py::class_<CModelStats, std::shared_ptr<CModelStats>>;
+using PyCModelSourceProfile = py::class_<CModelSourceProfile, std::shared_ptr<CModelSourceProfile>>;
 using PyCModelAlgorithm = py::class_<CModelAlgorithm, std::shared_ptr<CModelAlgorithm>>;
 
 PyCModelStageControl declareCModelStageControl(lsst::cpputils::python::WrapperCollection &wrappers) {
@@ -74,6 +78,9 @@ PyCModelControl declareCModelControl(lsst::cpputils::python::WrapperCollection &
         LSST_DECLARE_NESTED_CONTROL_FIELD(cls, CModelControl, dev);
         LSST_DECLARE_CONTROL_FIELD(cls, CModelControl, minInitialRadius);
         LSST_DECLARE_CONTROL_FIELD(cls, CModelControl, fallbackInitialMomentsPsfFactor);
+        LSST_DECLARE_CONTROL_FIELD(cls, CModelControl, fastPathSNThreshold);
+        LSST_DECLARE_CONTROL_FIELD(cls, CModelControl, fastPathRadiusThreshold);
+        LSST_DECLARE_CONTROL_FIELD(cls, CModelControl, fastPathMaxOuterIterations);
     });
 }
 
@@ -125,6 +132,7 @@ PyCModelStageResult declareCModelStageResult(lsst::cpputils::python::WrapperColl
         cls.def_readonly("nonlinear", &CModelStageResult::nonlinear);
         cls.def_readonly("amplitudes", &CModelStageResult::amplitudes);
         cls.def_readonly("fixed", &CModelStageResult::fixed);
+        cls.def_readonly("checkpoint", &CModelStageResult::checkpoint);
 
         // Declare wrappers for a view class for the flags attribute
         BitSetView<CModelStageResult::N_FLAGS>::declare(cls);
@@ -175,6 +183,43 @@ PyCModelResult declareCModelResult(lsst::cpputils::python::WrapperCollection &wr
     });
 }
 
+PyCModelStageStats declareCModelStageStats(lsst::cpputils::python::WrapperCollection &wrappers) {
+    return wrappers.wrapType(PyCModelStageStats(wrappers.module, "CModelStageStats"), [](auto &mod, auto &cls) {
+        cls.def(py::init<>());
+        cls.def_readonly("fitCount", &CModelStageStats::fitCount);
+        cls.def_readonly("iterationCount", &CModelStageStats::iterationCount);
+        cls.def_readonly("modelMatrixCount", &CModelStageStats::modelMatrixCount);
+        cls.def_readonly("time", &CModelStageStats::time);
+    });
+}
+
+PyCModelStats declareCModelStats(lsst::cpputils::python::WrapperCollection &wrappers) {
+    return wrappers.wrapType(PyCModelStats(wrappers.module, "CModelStats"), [](auto &mod, auto &cls) {
+        cls.def(py::init<>());
+        cls.def_readonly("initial", &CModelStats::initial);
+        cls.def_readonly("exp", &CModelStats::exp);
+        cls.def_readonly("dev", &CModelStats::dev);
+        cls.def_readonly("linearFitCount", &CModelStats::linearFitCount);
+        cls.def_readonly("linearTime", &CModelStats::linearTime);
+        cls.def_readonly("totalTime", &CModelStats::totalTime);
+    });
+}
+
+PyCModelSourceProfile declareCModelSourceProfile(lsst::cpputils::python::WrapperCollection &wrappers) {
+    return wrappers.wrapType(PyCModelSourceProfile(wrappers.module, "CModelSourceProfile"), [](auto &mod, auto &cls) {
+        cls.def(py::init<>());
+        cls.def_readonly("id", &CModelSourceProfile::id);
+        cls.def_readonly("time", &CModelSourceProfile::time);
+        cls.def_readonly("iterationCount", &CModelSourceProfile::iterationCount);
+        cls.def_readonly("footprintArea", &CModelSourceProfile::footprintArea);
+        // Reuses the BitSetView type already declared for CModelResult's flags.
+        cls.def_property_readonly(
+                "flags",
+                [](CModelSourceProfile const &self) { return BitSetView<CModelResult::N_FLAGS>(&self.flags); },
+                py::return_value_policy::reference_internal);
+    });
+}
+
 PyCModelAlgorithm declareCModelAlgorithm(lsst::cpputils::python::WrapperCollection &wrappers) {
     return wrappers.wrapType(PyCModelAlgorithm(wrappers.module, "CModelAlgorithm"), [](auto &mod, auto &cls) {
         cls.def(py::init<std::string const &, CModelControl const &, afw::table::Schema &>(), "name"_a, "ctrl"_a,
@@ -183,21 +228,36 @@ PyCModelAlgorithm declareCModelAlgorithm(lsst::cpputils::python::WrapperCollecti
                 "ctrl"_a, "schemaMapper"_a);
         cls.def(py::init<CModelControl const &>(), "ctrl"_a);
         cls.def("getControl", &CModelAlgorithm::getControl);
+        // The measurement entry points run entirely in C++ on afw objects and never
+        // call back into Python, so they release the GIL; a Python-level thread pool
+        // calling measure() (or measureBatch over sub-catalogs) can then use all
+        // cores without multiprocessing and exposure pickling.
         cls.def("apply", &CModelAlgorithm::apply, "exposure"_a, "psf"_a, "center"_a, "moments"_a,
-                "approxFlux"_a = -1, "kronRadius"_a = -1, "footprintArea"_a = -1);
+                "approxFlux"_a = -1, "kronRadius"_a = -1, "footprintArea"_a = -1,
+                "warmStart"_a = nullptr, py::call_guard<py::gil_scoped_release>());
         cls.def("applyForced", &CModelAlgorithm::applyForced, "exposure"_a, "psf"_a, "center"_a, "reference"_a,
-                "approxFlux"_a = -1);
+                "approxFlux"_a = -1, py::call_guard<py::gil_scoped_release>());
         cls.def("measure", (void (CModelAlgorithm::*)(afw::table::SourceRecord &,
                                                       afw::image::Exposure<Pixel> const &) const) &
                         CModelAlgorithm::measure,
-                "measRecord"_a, "exposure"_a);
+                "measRecord"_a, "exposure"_a, py::call_guard<py::gil_scoped_release>());
         cls.def("measure",
                 (void (CModelAlgorithm::*)(afw::table::SourceRecord &, afw::image::Exposure<Pixel> const &,
                                            afw::table::SourceRecord const &) const) &
                         CModelAlgorithm::measure,
-                "measRecord"_a, "exposure"_a, "refRecord"_a);
+                "measRecord"_a, "exposure"_a, "refRecord"_a, py::call_guard<py::gil_scoped_release>());
+        cls.def("measureBatch", &CModelAlgorithm::measureBatch,
+                "measCat"_a, "exposure"_a, "nThreads"_a = 1, "largestFirst"_a = true,
+                py::call_guard<py::gil_scoped_release>());
         cls.def("fail", &CModelAlgorithm::fail, "measRecord"_a, "error"_a);
         cls.def("writeResultToRecord", &CModelAlgorithm::writeResultToRecord, "result"_a, "record"_a);
+        cls.def("getStats", &CModelAlgorithm::getStats);
+        cls.def("resetStats", &CModelAlgorithm::resetStats);
+        cls.def("setProfilingEnabled", &CModelAlgorithm::setProfilingEnabled, "enabled"_a);
+        cls.def("getProfilingEnabled", &CModelAlgorithm::getProfilingEnabled);
+        cls.def("getSourceProfiles", &CModelAlgorithm::getSourceProfiles);
+        cls.def("clearSourceProfiles", &CModelAlgorithm::clearSourceProfiles);
+        cls.def("formatProfileReport", &CModelAlgorithm::formatProfileReport, "topN"_a = 10);
     });
 }
 }  // namespace
@@ -207,6 +267,9 @@ void wrapCmodel(lsst::cpputils::python::WrapperCollection &wrappers) {
     auto clsControl = declareCModelControl(wrappers);
     declareCModelStageResult(wrappers);
     auto clsResult = declareCModelResult(wrappers);
+    declareCModelStageStats(wrappers);
+    declareCModelStats(wrappers);
+    declareCModelSourceProfile(wrappers);
     auto clsAlgorithm = declareCModelAlgorithm(wrappers);
     clsAlgorithm.attr("Control") = clsControl;
     clsAlgorithm.attr("Result") = clsResult;
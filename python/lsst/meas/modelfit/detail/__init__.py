@@ -1 +1 @@
-from .._modelfitLib import phid, bvnu
+from .._modelfitLib import phid, bvnu, BvnuAccuracy
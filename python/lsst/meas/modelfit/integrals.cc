@@ -24,6 +24,8 @@
 #include "pybind11/pybind11.h"
 #include "lsst/cpputils/python.h"
 
+#include "ndarray/pybind11.h"
+
 #include "lsst/meas/modelfit/integrals.h"
 
 namespace py = pybind11;
@@ -34,8 +36,19 @@ namespace meas {
 namespace modelfit {
 
 void wrapIntegrals(lsst::cpputils::python::WrapperCollection &wrappers) {
+    py::enum_<detail::BvnuAccuracy>(wrappers.module, "BvnuAccuracy")
+            .value("FULL", detail::BvnuAccuracy::FULL)
+            .value("REDUCED", detail::BvnuAccuracy::REDUCED);
     wrappers.module.def("phid", &detail::phid);
-    wrappers.module.def("bvnu", &detail::bvnu);
+    wrappers.module.def("bvnu", (double (*)(double, double, double, detail::BvnuAccuracy)) & detail::bvnu,
+                        "h"_a, "k"_a, "rho"_a, "accuracy"_a = detail::BvnuAccuracy::FULL);
+    wrappers.module.def("bvnu",
+                        (void (*)(ndarray::Array<double const, 1, 1> const &,
+                                  ndarray::Array<double const, 1, 1> const &,
+                                  ndarray::Array<double const, 1, 1> const &,
+                                  ndarray::Array<double, 1, 1> const &, detail::BvnuAccuracy)) &
+                                detail::bvnu,
+                        "h"_a, "k"_a, "rho"_a, "out"_a, "accuracy"_a = detail::BvnuAccuracy::FULL);
 }
 
 }  // namespace modelfit
@@ -22,6 +22,7 @@
  */
 
 #include "pybind11/pybind11.h"
+#include "pybind11/eigen.h"
 #include "lsst/cpputils/python.h"
 
 #include "ndarray/pybind11.h"
@@ -36,9 +37,18 @@ namespace meas {
 namespace modelfit {
 
 using PyLikelihood = py::class_<Likelihood, std::shared_ptr<Likelihood>>;
+using PyFitStatistics = py::class_<Likelihood::FitStatistics>;
 
 void wrapLikelihood(lsst::cpputils::python::WrapperCollection &wrappers) {
     // py::module::import("lsst.meas.modelfit.model");
+    wrappers.wrapType(PyFitStatistics(wrappers.module, "LikelihoodFitStatistics"),
+                      [](auto &mod, auto &cls) {
+        cls.def_readonly("modelSquared", &Likelihood::FitStatistics::modelSquared);
+        cls.def_readonly("modelSquaredVariance", &Likelihood::FitStatistics::modelSquaredVariance);
+        cls.def_readonly("modelDotData", &Likelihood::FitStatistics::modelDotData);
+        cls.def_readonly("modelSum", &Likelihood::FitStatistics::modelSum);
+        cls.def_readonly("dataSquaredNorm", &Likelihood::FitStatistics::dataSquaredNorm);
+    });
     wrappers.wrapType(PyLikelihood(wrappers.module, "Likelihood"), [](auto &mod, auto &cls) {
         cls.def("getDataDim", &Likelihood::getDataDim);
         cls.def("getAmplitudeDim", &Likelihood::getAmplitudeDim);
@@ -52,6 +62,8 @@ void wrapLikelihood(lsst::cpputils::python::WrapperCollection &wrappers) {
         cls.def("getModel", &Likelihood::getModel);
         cls.def("computeModelMatrix", &Likelihood::computeModelMatrix, "modelMatrix"_a, "nonlinear"_a,
                 "doApplyWeights"_a = true);
+        cls.def("computeFitStatistics", &Likelihood::computeFitStatistics, "nonlinear"_a);
+        cls.def("clone", &Likelihood::clone);
     });
 }
 
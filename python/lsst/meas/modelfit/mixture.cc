@@ -56,6 +56,7 @@ PyMixtureComponent declareMixtureComponent(lsst::cpputils::python::WrapperCollec
                 cls.def("setMu", &MixtureComponent::setMu);
                 cls.def("getSigma", &MixtureComponent::getSigma);
                 cls.def("setSigma", &MixtureComponent::setSigma);
+                cls.def("isDiagonal", &MixtureComponent::isDiagonal);
                 cls.def("project", (MixtureComponent (MixtureComponent::*)(int) const) &MixtureComponent::project,
                         "dim"_a);
                 cls.def("project", (MixtureComponent (MixtureComponent::*)(int, int) const) &MixtureComponent::project,
@@ -93,6 +94,12 @@ PyMixture declareMixture(lsst::cpputils::python::WrapperCollection &wrappers) {
         cls.def("normalize", &Mixture::normalize);
         cls.def("shift", &Mixture::shift, "dim"_a, "offset"_a);
         cls.def("clip", &Mixture::clip, "threshold"_a = 0.0);
+        cls.def("getUpdateThreadCount", &Mixture::getUpdateThreadCount);
+        cls.def("setUpdateThreadCount", &Mixture::setUpdateThreadCount, "nThreads"_a);
+        cls.def("getDiagonalCovariance", &Mixture::getDiagonalCovariance);
+        cls.def("setDiagonalCovariance", &Mixture::setDiagonalCovariance, "diagonal"_a);
+        cls.def("getComponentPruningThreshold", &Mixture::getComponentPruningThreshold);
+        cls.def("setComponentPruningThreshold", &Mixture::setComponentPruningThreshold, "threshold"_a);
         cls.def("getDegreesOfFreedom", &Mixture::getDegreesOfFreedom);
         cls.def("setDegreesOfFreedom", &Mixture::setDegreesOfFreedom,
                 "df"_a = std::numeric_limits<Scalar>::infinity());
@@ -131,6 +138,8 @@ PyMixture declareMixture(lsst::cpputils::python::WrapperCollection &wrappers) {
                                                MixtureUpdateRestriction const &restriction, Scalar, Scalar)) &
                         Mixture::updateEM,
                 "x"_a, "restriction"_a, "tau1"_a = 0.0, "tau2"_a = 0.5);
+        cls.def("writeCompact", &Mixture::writeCompact, "filename"_a);
+        cls.def_static("readCompact", &Mixture::readCompact, "filename"_a);
         cls.def("clone", &Mixture::clone);
         cls.def(py::init<int, Mixture::ComponentList &, Scalar>(), "dim"_a, "components"_a,
                 "df"_a = std::numeric_limits<Scalar>::infinity());
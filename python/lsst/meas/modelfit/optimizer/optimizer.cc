@@ -47,6 +47,9 @@ using PyOptimizerControl = py::class_<OptimizerControl, std::shared_ptr<Optimize
 using PyOptimizerHistoryRecorder =
         py::class_<OptimizerHistoryRecorder, std::shared_ptr<OptimizerHistoryRecorder>>;
 using PyOptimizer = py::class_<Optimizer, std::shared_ptr<Optimizer>>;
+using PyOptimizerCheckpoint = py::class_<OptimizerCheckpoint, std::shared_ptr<OptimizerCheckpoint>>;
+using PyOptimizerIterationBuffer =
+        py::class_<OptimizerIterationBuffer, std::shared_ptr<OptimizerIterationBuffer>>;
 
 PyOptimizerObjective declareOptimizerObjective(lsst::cpputils::python::WrapperCollection &wrappers) {
     return wrappers.wrapType(PyOptimizerObjective(wrappers.module, "OptimizerObjective"), [](auto &mod, auto &cls) {
@@ -54,11 +57,14 @@ PyOptimizerObjective declareOptimizerObjective(lsst::cpputils::python::WrapperCo
         cls.def_readonly("dataSize", &OptimizerObjective::dataSize);
         cls.def_readonly("parameterSize", &OptimizerObjective::parameterSize);
         cls.def_static("makeFromLikelihood", &OptimizerObjective::makeFromLikelihood, "likelihood"_a,
-                       "prior"_a = nullptr);
+                       "prior"_a = nullptr, "doComputeJacobian"_a = false);
         // class is abstract and not subclassable in Python, so we don't wrap the ctor
         cls.def("fillObjectiveValueGrid", &OptimizerObjective::fillObjectiveValueGrid, "parameters"_a,
-                "output"_a);
+                "output"_a, py::call_guard<py::gil_scoped_release>());
         cls.def("computeResiduals", &OptimizerObjective::computeResiduals, "parameters"_a, "residuals"_a);
+        cls.def("clone", &OptimizerObjective::clone);
+        cls.def("getMemoCallCount", &OptimizerObjective::getMemoCallCount);
+        cls.def("getMemoHitCount", &OptimizerObjective::getMemoHitCount);
         cls.def("differentiateResiduals", &OptimizerObjective::differentiateResiduals, "parameters"_a,
                 "derivatives"_a);
         cls.def("hasPrior", &OptimizerObjective::hasPrior);
@@ -77,6 +83,7 @@ PyOptimizerControl declareOptimizerControl(lsst::cpputils::python::WrapperCollec
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, numDiffRelStep);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, numDiffAbsStep);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, numDiffTrustRadiusStep);
+        LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, numDiffThreads);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, stepAcceptThreshold);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, trustRegionInitialSize);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, trustRegionGrowReductionRatio);
@@ -85,6 +92,7 @@ PyOptimizerControl declareOptimizerControl(lsst::cpputils::python::WrapperCollec
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, trustRegionShrinkReductionRatio);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, trustRegionShrinkFactor);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, trustRegionSolverTolerance);
+        LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, useSteihaugCG);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, maxInnerIterations);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, maxOuterIterations);
         LSST_DECLARE_CONTROL_FIELD(cls, OptimizerControl, doSaveIterations);
@@ -125,6 +133,33 @@ PyOptimizerHistoryRecorder declareOptimizerHistoryRecorder(lsst::cpputils::pytho
     });
 }
 
+PyOptimizerCheckpoint declareOptimizerCheckpoint(lsst::cpputils::python::WrapperCollection &wrappers) {
+    return wrappers.wrapType(PyOptimizerCheckpoint(wrappers.module, "OptimizerCheckpoint"),
+                             [](auto &mod, auto &cls) {
+        cls.def(py::init<>());
+        cls.def_readwrite("parameters", &OptimizerCheckpoint::parameters);
+        cls.def_readwrite("trustRadius", &OptimizerCheckpoint::trustRadius);
+        cls.def_readwrite("hessian", &OptimizerCheckpoint::hessian);
+    });
+}
+
+PyOptimizerIterationBuffer declareOptimizerIterationBuffer(
+        lsst::cpputils::python::WrapperCollection &wrappers) {
+    return wrappers.wrapType(PyOptimizerIterationBuffer(wrappers.module, "OptimizerIterationBuffer"),
+                             [](auto &mod, auto &cls) {
+        cls.def(py::init<int, int, bool>(), "parameterSize"_a, "capacity"_a,
+                "doSaveDerivatives"_a = true);
+        cls.def("apply", &OptimizerIterationBuffer::apply, "outerIterCount"_a, "innerIterCount"_a,
+                "optimizer"_a);
+        cls.def("clear", &OptimizerIterationBuffer::clear);
+        cls.def("getParameterSize", &OptimizerIterationBuffer::getParameterSize);
+        cls.def("getCapacity", &OptimizerIterationBuffer::getCapacity);
+        cls.def("getSize", &OptimizerIterationBuffer::getSize);
+        cls.def("__len__", &OptimizerIterationBuffer::getSize);
+        cls.def("asCatalog", &OptimizerIterationBuffer::asCatalog);
+    });
+}
+
 PyOptimizer declareOptimizer(lsst::cpputils::python::WrapperCollection &wrappers) {
     return wrappers.wrapType(PyOptimizer(wrappers.module, "Optimizer"), [](auto &mod, auto &cls) {
         // StateFlags enum is used as bitflag, so we wrap values as int class attributes.
@@ -148,22 +183,33 @@ PyOptimizer declareOptimizer(lsst::cpputils::python::WrapperCollection &wrappers
         cls.def(py::init<std::shared_ptr<Optimizer::Objective const>, ndarray::Array<Scalar const, 1, 1> const &,
                         Optimizer::Control>(),
                 "objective"_a, "parameters"_a, "ctrl"_a);
+        cls.def(py::init<std::shared_ptr<Optimizer::Objective const>, OptimizerCheckpoint const &,
+                        Optimizer::Control>(),
+                "objective"_a, "checkpoint"_a, "ctrl"_a);
         cls.def("getObjective", &Optimizer::getObjective);
         cls.def("getControl", &Optimizer::getControl, py::return_value_policy::copy);
         cls.def("step", (bool (Optimizer::*)()) &Optimizer::step);
         cls.def("step", (bool (Optimizer::*)(Optimizer::HistoryRecorder const &, afw::table::BaseCatalog &)) &
                         Optimizer::step,
                 "recorder"_a, "history"_a);
-        cls.def("run", (int (Optimizer::*)()) &Optimizer::run);
+        cls.def("step", (bool (Optimizer::*)(OptimizerIterationBuffer &)) &Optimizer::step, "buffer"_a);
+        // run() loops entirely in C++ (objectives are not subclassable from Python),
+        // so release the GIL to let Python-level thread pools overlap optimizations.
+        cls.def("run", (int (Optimizer::*)()) &Optimizer::run,
+                py::call_guard<py::gil_scoped_release>());
         cls.def("run", (int (Optimizer::*)(Optimizer::HistoryRecorder const &, afw::table::BaseCatalog &)) &
                         Optimizer::run,
-                "recorder"_a, "history"_a);
+                "recorder"_a, "history"_a, py::call_guard<py::gil_scoped_release>());
+        cls.def("run", (int (Optimizer::*)(OptimizerIterationBuffer &)) &Optimizer::run, "buffer"_a,
+                py::call_guard<py::gil_scoped_release>());
         cls.def("getState", &Optimizer::getState);
         cls.def("getObjectiveValue", &Optimizer::getObjectiveValue);
         cls.def("getParameters", &Optimizer::getParameters);
         cls.def("getResiduals", &Optimizer::getResiduals);
         cls.def("getGradient", &Optimizer::getGradient);
         cls.def("getHessian", &Optimizer::getHessian);
+        cls.def("getTrustRadius", &Optimizer::getTrustRadius);
+        cls.def("getCheckpoint", &Optimizer::getCheckpoint);
         cls.def("removeSR1Term", &Optimizer::removeSR1Term);
     });
 }
@@ -173,12 +219,26 @@ void wrapOptimizer(lsst::cpputils::python::WrapperCollection &wrappers) {
     auto clsObjective = declareOptimizerObjective(wrappers);
     auto clsControl = declareOptimizerControl(wrappers);
     auto clsHistoryRecorder = declareOptimizerHistoryRecorder(wrappers);
+    auto clsCheckpoint = declareOptimizerCheckpoint(wrappers);
+    auto clsIterationBuffer = declareOptimizerIterationBuffer(wrappers);
     auto cls = declareOptimizer(wrappers);
     cls.attr("Objective") = clsObjective;
     cls.attr("Control") = clsControl;
     cls.attr("HistoryRecorder") = clsHistoryRecorder;
+    cls.attr("Checkpoint") = clsCheckpoint;
+    cls.attr("IterationBuffer") = clsIterationBuffer;
+
+    wrappers.wrapType(
+            py::class_<TrustRegionSolver>(wrappers.module, "TrustRegionSolver"),
+            [](auto &mod, auto &cls) {
+                cls.def(py::init<>());
+                cls.def("setProblem", &TrustRegionSolver::setProblem, "F"_a, "g"_a);
+                cls.def("solve", &TrustRegionSolver::solve, "x"_a, "r"_a, "tolerance"_a);
+            });
 
     wrappers.module.def("solveTrustRegion", &solveTrustRegion, "x"_a, "F"_a, "g"_a, "r"_a, "tolerance"_a);
+    wrappers.module.def("solveTrustRegionSteihaug", &solveTrustRegionSteihaug, "x"_a, "F"_a, "g"_a, "r"_a,
+                        "tolerance"_a);
 }
 
 }  // namespace modelfit
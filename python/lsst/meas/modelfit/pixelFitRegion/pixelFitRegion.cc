@@ -52,6 +52,7 @@ void wrapPixelFitRegion(lsst::cpputils::python::WrapperCollection &wrappers) {
         LSST_DECLARE_CONTROL_FIELD(cls, Control, maxArea);
         LSST_DECLARE_CONTROL_FIELD(cls, Control, badMaskPlanes);
         LSST_DECLARE_CONTROL_FIELD(cls, Control, maxBadPixelFraction);
+        LSST_DECLARE_CONTROL_FIELD(cls, Control, circularSpanTemplateTolerance);
     });
 
     wrappers.wrapType(PyPixelFitRegion(wrappers.module, "PixelFitRegion"), [](auto &mod, auto &cls) {
@@ -45,7 +45,17 @@ void declarePrior(lsst::cpputils::python::WrapperCollection &wrappers) {
 
     wrappers.wrapType(PyPrior(wrappers.module, "Prior"), [](auto &mod, auto &cls) {
         cls.def("getTag", &Prior::getTag);
-        cls.def("evaluate", &Prior::evaluate, "nonlinear"_a, "amplitudes"_a);
+        cls.def("evaluate",
+                (Scalar (Prior::*)(ndarray::Array<Scalar const, 1, 1> const &,
+                                   ndarray::Array<Scalar const, 1, 1> const &) const) &
+                        Prior::evaluate,
+                "nonlinear"_a, "amplitudes"_a);
+        cls.def("evaluate",
+                (void (Prior::*)(ndarray::Array<Scalar const, 2, 1> const &,
+                                 ndarray::Array<Scalar const, 2, 1> const &,
+                                 ndarray::Array<Scalar, 1, 1> const &) const) &
+                        Prior::evaluate,
+                "nonlinear"_a, "amplitudes"_a, "out"_a);
         cls.def("evaluateDerivatives", &Prior::evaluateDerivatives, "nonlinear"_a, "amplitudes"_a,
                 "nonlinearGradient"_a, "amplitudeGradient"_a, "nonlinearHessian"_a, "amplitudeHessian"_a,
                 "crossHessian"_a);
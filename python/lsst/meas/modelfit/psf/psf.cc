@@ -72,7 +72,12 @@ void declareDoubleShapelet(lsst::cpputils::python::WrapperCollection &wrappers)
         cls.def_static("makeObjective", &Algorithm::makeObjective, "moments"_a, "ctrl"_a, "psfImage"_a);
         cls.def_static("fitProfile", &Algorithm::fitProfile, "result"_a, "ctrl"_a, "psfImage"_a);
         cls.def_static("fitShapelets", &Algorithm::fitShapelets, "result"_a, "ctrl"_a, "psfImage"_a);
-        cls.def("measure", &Algorithm::measure, "measRecord"_a, "exposure"_a);
+        // Pure C++ measurement loops; release the GIL so Python thread pools can
+        // overlap them (see the CModelAlgorithm bindings).
+        cls.def("measure", &Algorithm::measure, "measRecord"_a, "exposure"_a,
+                py::call_guard<py::gil_scoped_release>());
+        cls.def("measureBatch", &Algorithm::measureBatch, "measCat"_a, "exposure"_a,
+                py::call_guard<py::gil_scoped_release>());
         cls.def("fail", &Algorithm::fail, "measRecord"_a, "error"_a = nullptr);
     });
 }
@@ -106,6 +111,9 @@ void declareGeneral(lsst::cpputils::python::WrapperCollection &wrappers) {
                 LSST_DECLARE_NESTED_CONTROL_FIELD(cls, Control, outer);
                 LSST_DECLARE_NESTED_CONTROL_FIELD(cls, Control, optimizer);
                 LSST_DECLARE_CONTROL_FIELD(cls, Control, defaultNoiseSigma);
+                LSST_DECLARE_CONTROL_FIELD(cls, Control, warmStartRadius);
+                LSST_DECLARE_CONTROL_FIELD(cls, Control, doCoarsePass);
+                LSST_DECLARE_CONTROL_FIELD(cls, Control, coarseBinFactor);
             });
 
     wrappers.wrapType(PyFitter(wrappers.module, "GeneralPsfFitter"), [](auto &mod, auto &cls) {
@@ -132,6 +140,20 @@ void declareGeneral(lsst::cpputils::python::WrapperCollection &wrappers) {
                                   shapelet::MultiShapeletFunction const &initial,
                                   Scalar noiseSigma) { return self.apply(image, initial, noiseSigma); },
                       "image"_a, "initial"_a, "noiseSigma"_a = -1);
+        cls.def("apply", [](Fitter const &self, afw::image::Image<Pixel> const &image,
+                                  afw::geom::ellipses::Quadrupole const &moments,
+                                  geom::Point2D const &position, Scalar noiseSigma) {
+                                      return self.apply(image, moments, position, noiseSigma);
+                                  },
+                      "image"_a, "moments"_a, "position"_a, "noiseSigma"_a = -1);
+        cls.def("apply", [](Fitter const &self, afw::image::Image<double> const &image,
+                                  afw::geom::ellipses::Quadrupole const &moments,
+                                  geom::Point2D const &position, Scalar noiseSigma) {
+                                      return self.apply(image, moments, position, noiseSigma);
+                                  },
+                      "image"_a, "moments"_a, "position"_a, "noiseSigma"_a = -1);
+        cls.def("getCacheSize", &Fitter::getCacheSize);
+        cls.def("clearCache", &Fitter::clearCache);
     });
 
     wrappers.wrapType(PyAlgorithm(wrappers.module, "GeneralPsfFitterAlgorithm"), [](auto &mod, auto &cls) {
@@ -0,0 +1,112 @@
+#
+# LSST Data Management System
+# Copyright 2008-2014 LSST Corporation.
+#
+# This product includes software developed by the
+# LSST Project (http://www.lsst.org/).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the LSST License Statement and
+# the GNU General Public License along with this program.  If not,
+# see <http://www.lsstcorp.org/LegalNotices/>.
+#
+"""Reader for the columnar sample-set files written by SampleSetWriter.
+
+The file is memory-mapped, so the returned column arrays are views into the
+file rather than copies; quantile or percentile computations over many objects
+never materialize catalogs.  See the SampleSetWriter doc comment for the
+layout.
+"""
+
+import numpy as np
+
+__all__ = ("SampleSetBlock", "readSampleSetFile")
+
+_MAGIC = b"MFSAMPLE"
+_VERSION = 1
+_HEADER_DTYPE = np.dtype([("magic", "S8"), ("version", "=i8"), ("parameterDim", "=i8")])
+
+
+class SampleSetBlock:
+    """One sample set from a columnar sample-set file.
+
+    Attributes
+    ----------
+    id : `int`
+        Identifier stored with the block (a running counter unless the writer
+        was given explicit IDs).
+    weight : `numpy.ndarray`
+        Normalized sample weights, shape ``(nSamples,)``.
+    objective : `numpy.ndarray`
+        Objective values (usually -log posterior), shape ``(nSamples,)``.
+    proposal : `numpy.ndarray`
+        -log proposal density values, shape ``(nSamples,)``.
+    parameters : `numpy.ndarray`
+        Nonlinear parameters, shape ``(nSamples, parameterDim)``.
+
+    All arrays are read-only views into the memory-mapped file.
+    """
+
+    def __init__(self, id, weight, objective, proposal, parameters):
+        self.id = id
+        self.weight = weight
+        self.objective = objective
+        self.proposal = proposal
+        self.parameters = parameters
+
+
+def readSampleSetFile(filename):
+    """Memory-map a columnar sample-set file written by SampleSetWriter.
+
+    Parameters
+    ----------
+    filename : `str`
+        Path of the file to read.
+
+    Returns
+    -------
+    blocks : `list` of `SampleSetBlock`
+        One entry per appended sample set, in append order; the column arrays
+        are views into a single shared memory map.
+    """
+    data = np.memmap(filename, dtype=np.uint8, mode="r")
+    if data.size < _HEADER_DTYPE.itemsize:
+        raise IOError("File '%s' is too short to be a sample set file" % filename)
+    header = data[:_HEADER_DTYPE.itemsize].view(_HEADER_DTYPE)[0]
+    if header["magic"] != _MAGIC:
+        raise IOError("File '%s' is not a sample set file (bad magic)" % filename)
+    if header["version"] != _VERSION:
+        raise IOError("Sample set file '%s' has unsupported version %d"
+                      % (filename, header["version"]))
+    parameterDim = int(header["parameterDim"])
+    blocks = []
+    offset = _HEADER_DTYPE.itemsize
+    while offset < data.size:
+        # Stop at a trailing partial block (e.g. from an interrupted run); the
+        # file is valid up to its last complete block.
+        if offset + 16 > data.size:
+            break
+        id, nSamples = (int(v) for v in data[offset:offset + 16].view("=i8"))
+        offset += 16
+        nBytes = (3 + parameterDim)*nSamples*8
+        if offset + nBytes > data.size:
+            break
+        columns = data[offset:offset + nBytes].view("=f8")
+        offset += nBytes
+        blocks.append(SampleSetBlock(
+            id=id,
+            weight=columns[:nSamples],
+            objective=columns[nSamples:2*nSamples],
+            proposal=columns[2*nSamples:3*nSamples],
+            parameters=columns[3*nSamples:].reshape(nSamples, parameterDim),
+        ))
+    return blocks
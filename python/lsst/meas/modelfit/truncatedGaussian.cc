@@ -42,7 +42,10 @@ using Sampler = TruncatedGaussianSampler;
 using Evaluator = TruncatedGaussianEvaluator;
 using LogEvaluator = TruncatedGaussianLogEvaluator;
 
+using Builder = TruncatedGaussianBuilder;
+
 using PyTruncatedGaussian = py::class_<TruncatedGaussian, std::shared_ptr<TruncatedGaussian>>;
+using PyBuilder = py::class_<Builder, std::shared_ptr<Builder>>;
 using PySampler = py::class_<Sampler, std::shared_ptr<Sampler>>;
 using PyEvaluator = py::class_<Evaluator, std::shared_ptr<Evaluator>>;
 using PyLogEvaluator = py::class_<LogEvaluator, std::shared_ptr<LogEvaluator>>;
@@ -84,6 +87,15 @@ PySampler declareSampler(lsst::cpputils::python::WrapperCollection &wrappers) {
     });
 }
 
+PyBuilder declareBuilder(lsst::cpputils::python::WrapperCollection &wrappers) {
+    return wrappers.wrapType(
+            PyBuilder(wrappers.module, "TruncatedGaussianBuilder"), [](auto &mod, auto &cls) {
+                cls.def(py::init<int>(), "dim"_a);
+                cls.def("__call__", &Builder::operator(), "q0"_a, "gradient"_a, "hessian"_a);
+                cls.def("getDim", &Builder::getDim);
+            });
+}
+
 using PySampleStrategy = py::enum_<TruncatedGaussian::SampleStrategy>;
 
 PySampleStrategy declareSampleStrategy(lsst::cpputils::python::WrapperCollection &wrappers) {
@@ -124,6 +136,7 @@ void wrapTruncatedGaussian(lsst::cpputils::python::WrapperCollection &wrappers)
     clsTruncatedGaussian.attr("LogEvaluator") = declareEvaluator<LogEvaluator, PyLogEvaluator>(wrappers, "LogEvaluator");
     clsTruncatedGaussian.attr("Evaluator") = declareEvaluator<Evaluator, PyEvaluator>(wrappers, "Evaluator");
     clsTruncatedGaussian.attr("Sampler") = declareSampler(wrappers);
+    declareBuilder(wrappers);
 }
 
 }  // namespace modelfit
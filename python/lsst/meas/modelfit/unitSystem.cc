@@ -35,6 +35,7 @@ namespace modelfit {
 
 using PyUnitSystem = py::class_<UnitSystem, std::shared_ptr<UnitSystem>>;
 using PyLocalUnitTransform = py::class_<LocalUnitTransform, std::shared_ptr<LocalUnitTransform>>;
+using PyUnitTransformCache = py::class_<UnitTransformCache, std::shared_ptr<UnitTransformCache>>;
 
 void wrapUnitSystem(lsst::cpputils::python::WrapperCollection &wrappers) {
     // Data member wrappers in this module are intentionally read-only;
@@ -62,6 +63,15 @@ void wrapUnitSystem(lsst::cpputils::python::WrapperCollection &wrappers) {
                                   "sourcePixel"_a, "source"_a, "destination"_a);
         cls.def(py::init<>());
     });
+
+    wrappers.wrapType(PyUnitTransformCache(wrappers.module, "UnitTransformCache"),
+                      [](auto &mod, auto &cls) {
+        cls.def(py::init<UnitSystem const &>(), "measSys"_a);
+        cls.def("getMeasSys", &UnitTransformCache::getMeasSys);
+        cls.def("makeFitSys", &UnitTransformCache::makeFitSys, "position"_a, "flux"_a);
+        cls.def("makeFitSysToMeasSys", &UnitTransformCache::makeFitSysToMeasSys,
+                "position"_a, "fitSys"_a);
+    });
 }
 
 }  // namespace modelfit
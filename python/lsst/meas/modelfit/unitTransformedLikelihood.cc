@@ -28,6 +28,7 @@
 #include "ndarray/pybind11.h"
 
 #include "lsst/pex/config/python.h"
+#include "lsst/meas/modelfit/GaussianMatrixBuilder.h"
 #include "lsst/meas/modelfit/UnitTransformedLikelihood.h"
 
 namespace py = pybind11;
@@ -45,13 +46,33 @@ using PyEpochFootprint = py::class_<EpochFootprint, std::shared_ptr<EpochFootpri
 using PyUnitTransformedLikelihood =
         py::class_<UnitTransformedLikelihood, std::shared_ptr<UnitTransformedLikelihood>, Likelihood>;
 
+using PyGaussianMatrixBuilder = py::class_<GaussianMatrixBuilder, std::shared_ptr<GaussianMatrixBuilder>>;
+
 void wrapUnitTransformedLikelihood(lsst::cpputils::python::WrapperCollection &wrappers) {
+    wrappers.wrapType(PyGaussianMatrixBuilder(wrappers.module, "GaussianMatrixBuilder"),
+                      [](auto &mod, auto &cls) {
+        cls.def(py::init<ndarray::Array<Pixel const, 1, 1> const &,
+                         ndarray::Array<Pixel const, 1, 1> const &,
+                         shapelet::MultiShapeletBasis const &,
+                         shapelet::MultiShapeletFunction const &>(),
+                "x"_a, "y"_a, "basis"_a, "psf"_a);
+        cls.def_static("isCompatible", &GaussianMatrixBuilder::isCompatible, "basis"_a, "psf"_a);
+        cls.def("getBasisSize", &GaussianMatrixBuilder::getBasisSize);
+        cls.def("getDataSize", &GaussianMatrixBuilder::getDataSize);
+        cls.def("__call__", &GaussianMatrixBuilder::operator(), "output"_a, "ellipse"_a);
+    });
     wrappers.wrapType(
             PyUnitTransformedLikelihoodControl(wrappers.module, "UnitTransformedLikelihoodControl"),
             [](auto &mod, auto &cls) {
                 LSST_DECLARE_CONTROL_FIELD(cls, UnitTransformedLikelihoodControl, usePixelWeights);
                 LSST_DECLARE_CONTROL_FIELD(cls, UnitTransformedLikelihoodControl, weightsMultiplier);
-                cls.def(py::init<bool>(), "usePixelWeights"_a = false);
+                LSST_DECLARE_CONTROL_FIELD(cls, UnitTransformedLikelihoodControl, nThreads);
+                LSST_DECLARE_CONTROL_FIELD(cls, UnitTransformedLikelihoodControl, blockSize);
+                LSST_DECLARE_CONTROL_FIELD(cls, UnitTransformedLikelihoodControl, tileSkipThreshold);
+                LSST_DECLARE_CONTROL_FIELD(cls, UnitTransformedLikelihoodControl, binFactor);
+                LSST_DECLARE_CONTROL_FIELD(cls, UnitTransformedLikelihoodControl, binCoreRadius);
+                cls.def(py::init<bool, double, int>(), "usePixelWeights"_a = false,
+                        "weightsMultiplier"_a = 1.0, "nThreads"_a = 1);
             });
     wrappers.wrapType(PyEpochFootprint(wrappers.module, "EpochFootprint"), [](auto &mod, auto &cls) {
         cls.def(py::init<afw::detection::Footprint const &, afw::image::Exposure<Pixel> const &,
@@ -20,7 +20,13 @@
  * the GNU General Public License along with this program.  If not,
  * see <http://www.lsstcorp.org/LegalNotices/>.
  */
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include "ndarray/eigen.h"
 
@@ -28,6 +34,8 @@
 #include "lsst/afw/table/BaseRecord.h"
 #include "lsst/afw/table/Catalog.h"
 #include "lsst/meas/modelfit/AdaptiveImportanceSampler.h"
+#include "lsst/meas/modelfit/SampleSetFile.h"
+#include "lsst/meas/modelfit/splitRandom.h"
 
 namespace lsst { namespace meas { namespace modelfit {
 
@@ -111,11 +119,15 @@ void AdaptiveImportanceSampler::run(
 ) const {
     LOG_LOGGER trace3Logger = LOG_GET("TRACE3.meas.modelfit.AdaptiveImportanceSampler");
     double perplexity = 0.0;
+    double essFraction = 0.0;
     int parameterDim = objective.getParameterDim();
     for (std::map<int,ImportanceSamplerControl>::const_iterator i = _ctrls.begin(); i != _ctrls.end(); ++i) {
         ImportanceSamplerControl const & ctrl = i->second;
         int nRepeat = 0;
-        while (nRepeat <= ctrl.maxRepeat && perplexity < ctrl.targetPerplexity) {
+        while (nRepeat <= ctrl.maxRepeat
+               && perplexity < ctrl.targetPerplexity
+               && (ctrl.targetEffectiveSampleSizeFraction <= 0.0
+                   || essFraction < ctrl.targetEffectiveSampleSizeFraction)) {
             LOGL_DEBUG(trace3Logger,
                 "Starting repeat %d with nSamples=%d, nUpdateSteps=%d, targetPerplexity=%g",
                 nRepeat, ctrl.nSamples, ctrl.nUpdateSteps, ctrl.targetPerplexity
@@ -126,16 +138,89 @@ void AdaptiveImportanceSampler::run(
             }
             afw::table::BaseCatalog subSamples(samples.getTable());
             ndarray::Array<Scalar,2,2> parameters = ndarray::allocate(ctrl.nSamples, parameterDim);
-            proposal->draw(*_rng, parameters);
             ndarray::Array<Scalar,1,1> probability = ndarray::allocate(ctrl.nSamples);
-            proposal->evaluate(parameters, probability);
+            int const nChains = std::min(std::max(ctrl.nChains, 1), ctrl.nSamples);
+            if (nChains > 1) {
+                // Multi-chain mode: each chain draws a contiguous block of the
+                // sample array with its own random number stream.  The chain
+                // generators are split from the main generator by counter-based
+                // mixing of (iteration stream, chain id), with only a single
+                // draw consumed from the main stream per iteration, so the
+                // merged sample set is deterministic given the seed and the
+                // main stream advances by the same amount for any chain count.
+                // Mixture evaluation and drawing use only local scratch, so all
+                // chains share the one proposal read-only; the EM updates below
+                // still see one proposal and one merged catalog.
+                std::uint64_t const streamIndex =
+                    _rng->uniformInt(std::numeric_limits<unsigned int>::max());
+                std::vector<std::shared_ptr<afw::math::Random>> rngs;
+                rngs.reserve(nChains);
+                for (int c = 0; c < nChains; ++c) {
+                    rngs.push_back(splitRandom(*_rng, streamIndex, c));
+                }
+                std::vector<std::thread> chains;
+                chains.reserve(nChains);
+                for (int c = 0; c < nChains; ++c) {
+                    int const begin = c*ctrl.nSamples/nChains;
+                    int const end = (c + 1)*ctrl.nSamples/nChains;
+                    chains.emplace_back(
+                        [&parameters, &probability, &rngs, &proposal, c, begin, end]() {
+                            proposal->draw(*rngs[c], parameters[ndarray::view(begin, end)]);
+                            proposal->evaluate(
+                                parameters[ndarray::view(begin, end)],
+                                probability[ndarray::view(begin, end)]
+                            );
+                        }
+                    );
+                }
+                for (auto & chain : chains) {
+                    chain.join();
+                }
+            } else {
+                proposal->draw(*_rng, parameters);
+                proposal->evaluate(parameters, probability);
+            }
+            // The objective evaluations are independent, so when ctrl.nThreads > 1
+            // we farm them out to threads that pull sample indices from a shared
+            // atomic counter and write to preassigned records and output slots,
+            // merging without locks.  Record creation and catalog insertion stay
+            // serial, as afw::table is not thread-safe.
+            std::vector<std::shared_ptr<afw::table::BaseRecord>> records;
+            records.reserve(ctrl.nSamples);
             for (int k = 0; k < ctrl.nSamples; ++k) {
-                std::shared_ptr<afw::table::BaseRecord> record = samples.addNew();
-                double objectiveValue = objective(parameters[k], *record);
-                if (std::isfinite(objectiveValue)) {
+                records.push_back(samples.getTable()->makeRecord());
+            }
+            ndarray::Array<Scalar,1,1> objectiveValues = ndarray::allocate(ctrl.nSamples);
+            if (ctrl.nThreads > 1) {
+                std::atomic<int> nextSample(0);
+                std::vector<std::thread> threads;
+                int const nThreads = std::min(ctrl.nThreads, ctrl.nSamples);
+                threads.reserve(nThreads);
+                for (int t = 0; t < nThreads; ++t) {
+                    threads.emplace_back(
+                        [&objective, &parameters, &records, &objectiveValues, &nextSample, &ctrl]() {
+                            int k;
+                            while ((k = nextSample.fetch_add(1)) < ctrl.nSamples) {
+                                objectiveValues[k] = objective(parameters[k], *records[k]);
+                            }
+                        }
+                    );
+                }
+                for (auto & thread : threads) {
+                    thread.join();
+                }
+            } else {
+                for (int k = 0; k < ctrl.nSamples; ++k) {
+                    objectiveValues[k] = objective(parameters[k], *records[k]);
+                }
+            }
+            for (int k = 0; k < ctrl.nSamples; ++k) {
+                if (std::isfinite(objectiveValues[k])) {
+                    std::shared_ptr<afw::table::BaseRecord> record = records[k];
+                    samples.push_back(record);
                     subSamples.push_back(record);
                     record->set(_parametersKey, parameters[k]);
-                    record->set(_objectiveKey, objectiveValue);
+                    record->set(_objectiveKey, objectiveValues[k]);
                     record->set(_proposalKey, -std::log(probability[k]));
                     if (_doSaveIterations) {
                         record->set(_iterCtrlKey, i->first);
@@ -144,8 +229,6 @@ void AdaptiveImportanceSampler::run(
                     // for numerical reasons, in the first pass, we set w_i = ln(p_i/q_i);
                     // note that proposal[i] == -ln(q_i) and objective[i] == -ln(p_i)
                     record->set(_weightKey, record->get(_proposalKey) - record->get(_objectiveKey));
-                } else {
-                    samples.pop_back();
                 }
             }
             if (samples.empty()) {
@@ -166,6 +249,11 @@ void AdaptiveImportanceSampler::run(
                 "Normalized perplexity is %g; target is %g",
                 perplexity, ctrl.targetPerplexity
             );
+            essFraction = computeEffectiveSampleSizeFraction(subSamples);
+            LOGL_DEBUG(trace3Logger,
+                "Effective sample size fraction is %g; target is %g",
+                essFraction, ctrl.targetEffectiveSampleSizeFraction
+            );
             if (ctrl.nUpdateSteps > 0) {
                 for (std::size_t k = 0; k < subSamples.size(); ++k) {
                     parameters[k] = subSamples[k].get(_parametersKey);
@@ -181,6 +269,9 @@ void AdaptiveImportanceSampler::run(
             }
         }
     }
+    if (_sampleWriter) {
+        _sampleWriter->append(samples);
+    }
 }
 
 double AdaptiveImportanceSampler::computeNormalizedPerplexity(
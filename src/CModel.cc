@@ -20,10 +20,21 @@
  * the GNU General Public License along with this program.  If not,
  * see <http://www.lsstcorp.org/LegalNotices/>.
  */
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
+#include <exception>
+#include <map>
 #include <memory>
 #include <bitset>
 #include <filesystem>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <tuple>
 
 #include "ndarray/eigen.h"
 
@@ -57,31 +68,76 @@ Pixel computeFluxInFootprint(
     return std::max(a, b);
 }
 
+// Process-wide flyweight registry for the radial-profile bases used by the stage
+// models.  Every measureBatch worker (and every algorithm instance) constructs its
+// own Model per stage, but the underlying basis depends only on the profile name
+// and the truncation parameters, so identical bases are interned here and shared.
+// Entries are held strongly for the life of the process: short-lived tasks
+// construct and destroy their algorithm instances back-to-back, and a weakly-held
+// entry would be dropped and re-materialized on every construction.  Only the
+// handful of distinct (profile, nComponents, maxRadius) configurations ever used
+// are resident, so the memory pinned is a few small matrices per configuration.
+std::shared_ptr<shapelet::MultiShapeletBasis> getInternedBasis(
+    shapelet::RadialProfile const & profile, int nComponents, double maxRadius
+) {
+    typedef std::tuple<std::string,int,double> Key;
+    static std::mutex mutex;
+    static std::map<Key,std::shared_ptr<shapelet::MultiShapeletBasis>> registry;
+    Key const key(profile.getName(), nComponents, maxRadius);
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<shapelet::MultiShapeletBasis> & basis = registry[key];
+    if (!basis) {
+        basis = profile.getBasis(nComponents, maxRadius);
+    }
+    return basis;
+}
+
+// Process-wide cache of priors materialized from persisted mixture files, keyed
+// by prior name.  Each stage control (initial/exp/dev) and each task
+// instantiation otherwise re-reads and re-materializes the same FITS file;
+// sharing one immutable prior per process cuts that to a single load.  Sharing
+// pages across worker processes is left to the OS (the file read goes through
+// the page cache); the priors themselves are not relocatable structures.
+std::shared_ptr<MixturePrior> getInternedFilePrior(std::string const & priorName) {
+    static std::mutex mutex;
+    static std::map<std::string,std::weak_ptr<MixturePrior>> registry;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto i = registry.find(priorName);
+    if (i != registry.end()) {
+        if (std::shared_ptr<MixturePrior> prior = i->second.lock()) {
+            return prior;
+        }
+    }
+    char const * pkgDir = std::getenv("MEAS_MODELFIT_DIR");
+    if (!pkgDir) {
+        throw LSST_EXCEPT(
+            meas::base::FatalAlgorithmError,
+            "MEAS_MODELFIT_DIR environment variable not defined; cannot find persisted Priors"
+        );
+    }
+    std::filesystem::path priorPath
+        = std::filesystem::path(pkgDir)
+        / std::filesystem::path("data")
+        / std::filesystem::path(priorName + ".fits");
+    std::shared_ptr<Mixture> mixture = Mixture::readFits(priorPath.string());
+    std::shared_ptr<MixturePrior> prior = std::make_shared<MixturePrior>(mixture, "single-ellipse");
+    registry[priorName] = prior;
+    return prior;
+}
+
 } // anonymous
 
 //-------------------- Control Objects ----------------------------------------------------------------------
 
 std::shared_ptr<Model> CModelStageControl::getModel() const {
-    return Model::make(getProfile().getBasis(nComponents, maxRadius), Model::FIXED_CENTER);
+    return Model::make(getInternedBasis(getProfile(), nComponents, maxRadius), Model::FIXED_CENTER);
 }
 
     std::shared_ptr<Prior> CModelStageControl::getPrior() const {
     if (priorSource == "NONE") {
         return std::shared_ptr<Prior>();
     } else if (priorSource == "FILE") {
-        char const * pkgDir = std::getenv("MEAS_MODELFIT_DIR");
-        if (!pkgDir) {
-            throw LSST_EXCEPT(
-                meas::base::FatalAlgorithmError,
-                "MEAS_MODELFIT_DIR environment variable not defined; cannot find persisted Priors"
-            );
-        }
-        std::filesystem::path priorPath
-            = std::filesystem::path(pkgDir)
-            / std::filesystem::path("data")
-            / std::filesystem::path(priorName + ".fits");
-        std::shared_ptr<Mixture> mixture = Mixture::readFits(priorPath.string());
-        return std::make_shared<MixturePrior>(mixture, "single-ellipse");
+        return getInternedFilePrior(priorName);
     } else if (priorSource == "LINEAR") {
         return std::make_shared<SoftenedLinearPrior>(linearPriorConfig);
     } else if (priorSource == "EMPIRICAL") {
@@ -252,7 +308,6 @@ struct CModelStageKeys {
     void copyResultToRecord(CModelStageResult const & result, afw::table::BaseRecord & record) {
         record.set(instFlux, result.instFlux);
         record.set(instFluxErr, result.instFluxErr);
-        record.set(fluxFlag, result.flags[CModelStageResult::FAILED]);
         record.set(instFluxInner, result.instFluxInner);
         if (objective.isValid()) {
             record.set(objective, result.objective);
@@ -272,6 +327,14 @@ struct CModelStageKeys {
         if (time.isValid()) {
             record.set(time, result.time);
         }
+        copyResultFlagsToRecord(result, record);
+    }
+
+    // Flag-only subset of copyResultToRecord; the buffered catalog writer calls this
+    // in a separate record-major pass because flag fields are bit-packed into shared
+    // integer words within each record and cannot be written through a column view.
+    void copyResultFlagsToRecord(CModelStageResult const & result, afw::table::BaseRecord & record) {
+        record.set(fluxFlag, result.flags[CModelStageResult::FAILED]);
         for (int b = 0; b < CModelStageResult::N_FLAGS; ++b) {
             if (flags[b].isValid()) {
                 record.set(flags[b], result.flags[b]);
@@ -279,6 +342,76 @@ struct CModelStageKeys {
         }
     }
 
+    // Write this stage's non-flag fields for a whole block of results, one output
+    // column at a time (see CModelKeys::copyResultsToCatalog).
+    void copyResultsToColumns(
+        std::vector<CModelResult> const & results,
+        CModelStageResult CModelResult::*stage,
+        afw::table::BaseColumnView & columns
+    ) {
+        std::size_t const n = results.size();
+        auto instFluxCol = columns[instFlux];
+        auto instFluxErrCol = columns[instFluxErr];
+        auto instFluxInnerCol = columns[instFluxInner];
+        for (std::size_t i = 0; i < n; ++i) {
+            CModelStageResult const & r = results[i].*stage;
+            instFluxCol[i] = r.instFlux;
+            instFluxErrCol[i] = r.instFluxErr;
+            instFluxInnerCol[i] = r.instFluxInner;
+        }
+        if (objective.isValid()) {
+            auto col = columns[objective];
+            for (std::size_t i = 0; i < n; ++i) {
+                col[i] = (results[i].*stage).objective;
+            }
+        }
+        if (ellipse.isValid()) {
+            auto xx = columns[ellipse.getIxx()];
+            auto yy = columns[ellipse.getIyy()];
+            auto xy = columns[ellipse.getIxy()];
+            for (std::size_t i = 0; i < n; ++i) {
+                CModelStageResult const & r = results[i].*stage;
+                xx[i] = r.ellipse.getIxx();
+                yy[i] = r.ellipse.getIyy();
+                xy[i] = r.ellipse.getIxy();
+            }
+        }
+        if (nonlinear.isValid()) {
+            for (int j = 0; j < nonlinear.getSize(); ++j) {
+                auto col = columns[nonlinear[j]];
+                for (std::size_t i = 0; i < n; ++i) {
+                    CModelStageResult const & r = results[i].*stage;
+                    if (!r.nonlinear.isEmpty()) {
+                        col[i] = r.nonlinear[j];
+                    }
+                }
+            }
+        }
+        if (fixed.isValid()) {
+            for (int j = 0; j < fixed.getSize(); ++j) {
+                auto col = columns[fixed[j]];
+                for (std::size_t i = 0; i < n; ++i) {
+                    CModelStageResult const & r = results[i].*stage;
+                    if (!r.fixed.isEmpty()) {
+                        col[i] = r.fixed[j];
+                    }
+                }
+            }
+        }
+        if (nIter.isValid()) {
+            auto col = columns[nIter];
+            for (std::size_t i = 0; i < n; ++i) {
+                col[i] = (results[i].*stage).history.size();
+            }
+        }
+        if (time.isValid()) {
+            auto col = columns[time];
+            for (std::size_t i = 0; i < n; ++i) {
+                col[i] = (results[i].*stage).time;
+            }
+        }
+    }
+
     CModelStageResult copyRecordToResult(afw::table::BaseRecord const & record) const {
         // this is only used when reading reference records, so we only transfer the fields we need for that
         CModelStageResult result;
@@ -492,6 +625,94 @@ struct CModelKeys {
         }
     }
 
+    // Write a block of buffered results into the catalog, making one contiguous pass
+    // per output column instead of scattering each result across its record's strided
+    // fields.  Equivalent to calling copyResultToRecord for each (result, record) pair.
+    void copyResultsToCatalog(
+        std::vector<CModelResult> const & results,
+        afw::table::SourceCatalog & catalog
+    ) {
+        LSST_THROW_IF_NE(
+            int(results.size()), int(catalog.size()),
+            pex::exceptions::LengthError,
+            "Number of results (%d) does not match number of records (%d)"
+        );
+        if (!catalog.isContiguous()) {
+            // Column views require contiguous records; fall back to per-record writes.
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                copyResultToRecord(results[i], catalog[i]);
+            }
+            return;
+        }
+        std::size_t const n = results.size();
+        auto columns = catalog.getColumnView();
+        initial.copyResultsToColumns(results, &CModelResult::initial, columns);
+        exp.copyResultsToColumns(results, &CModelResult::exp, columns);
+        dev.copyResultsToColumns(results, &CModelResult::dev, columns);
+        {
+            auto instFluxCol = columns[instFlux];
+            auto instFluxErrCol = columns[instFluxErr];
+            auto instFluxInnerCol = columns[instFluxInner];
+            auto fracDevCol = columns[fracDev];
+            auto objectiveCol = columns[objective];
+            for (std::size_t i = 0; i < n; ++i) {
+                CModelResult const & r = results[i];
+                instFluxCol[i] = r.instFlux;
+                instFluxErrCol[i] = r.instFluxErr;
+                instFluxInnerCol[i] = r.instFluxInner;
+                fracDevCol[i] = r.fracDev;
+                objectiveCol[i] = r.objective;
+            }
+        }
+        if (ellipse.isValid()) {
+            auto xx = columns[ellipse.getIxx()];
+            auto yy = columns[ellipse.getIyy()];
+            auto xy = columns[ellipse.getIxy()];
+            for (std::size_t i = 0; i < n; ++i) {
+                CModelResult const & r = results[i];
+                double u = 1.0 - r.fracDev;
+                double v = r.fracDev;
+                xx[i] = u*r.exp.ellipse.getIxx() + v*r.dev.ellipse.getIxx();
+                yy[i] = u*r.exp.ellipse.getIyy() + v*r.dev.ellipse.getIyy();
+                xy[i] = u*r.exp.ellipse.getIxy() + v*r.dev.ellipse.getIxy();
+            }
+        }
+        if (initialFitRegion.isValid()) {
+            auto xx = columns[initialFitRegion.getIxx()];
+            auto yy = columns[initialFitRegion.getIyy()];
+            auto xy = columns[initialFitRegion.getIxy()];
+            for (std::size_t i = 0; i < n; ++i) {
+                xx[i] = results[i].initialFitRegion.getIxx();
+                yy[i] = results[i].initialFitRegion.getIyy();
+                xy[i] = results[i].initialFitRegion.getIxy();
+            }
+        }
+        if (finalFitRegion.isValid()) {
+            auto xx = columns[finalFitRegion.getIxx()];
+            auto yy = columns[finalFitRegion.getIyy()];
+            auto xy = columns[finalFitRegion.getIxy()];
+            for (std::size_t i = 0; i < n; ++i) {
+                xx[i] = results[i].finalFitRegion.getIxx();
+                yy[i] = results[i].finalFitRegion.getIyy();
+                xy[i] = results[i].finalFitRegion.getIxy();
+            }
+        }
+        // Flag fields can't go through the column view (they're bit-packed into shared
+        // integer words within each record), so write them record-major, touching each
+        // record's flag words exactly once.
+        for (std::size_t i = 0; i < n; ++i) {
+            afw::table::BaseRecord & record = catalog[i];
+            initial.copyResultFlagsToRecord(results[i].initial, record);
+            exp.copyResultFlagsToRecord(results[i].exp, record);
+            dev.copyResultFlagsToRecord(results[i].dev, record);
+            for (int b = 0; b < CModelResult::N_FLAGS; ++b) {
+                if (flags[b].isValid()) {
+                    record.set(flags[b], results[i].flags[b]);
+                }
+            }
+        }
+    }
+
     CModelResult copyRecordToResult(afw::table::BaseRecord const & record) const {
         // this is only used when reading reference records, so we only transfer the fields we need for that
         CModelResult result;
@@ -562,13 +783,14 @@ struct CModelStageData {
 
     CModelStageData(
         afw::image::Exposure<Pixel> const & exposure,
+        UnitTransformCache const & unitCache,
         Scalar approxFlux, geom::Point2D const & center,
         shapelet::MultiShapeletFunction const & psf_,
         Model const & model
     ) :
         measSysCenter(center), position(exposure.getWcs()->pixelToSky(center)),
-        measSys(exposure), fitSys(position, exposure.getPhotoCalib(), approxFlux),
-        fitSysToMeasSys(fitSys.wcs->getPixelOrigin(), fitSys, measSys),
+        measSys(unitCache.getMeasSys()), fitSys(unitCache.makeFitSys(position, approxFlux)),
+        fitSysToMeasSys(unitCache.makeFitSysToMeasSys(position, fitSys)),
         parameters(ndarray::allocate(model.getNonlinearDim() + model.getAmplitudeDim())),
         nonlinear(parameters[ndarray::view(0, model.getNonlinearDim())]),
         amplitudes(parameters[ndarray::view(model.getNonlinearDim(), parameters.getSize<0>())]),
@@ -602,19 +824,63 @@ struct CModelStageData {
 
 namespace {
 
-// utility function to create a model matrix: just allocates space for the matrix and calls the likelihood
-// object to do the work.
+// Reusable backing storage for the per-source model matrix.  The buffer grows
+// monotonically to the largest footprint seen, so steady-state catalog
+// measurement stops paying a large malloc/free per source per stage.  Arenas
+// are held by the (per-thread, when measureBatch is used) implementation
+// objects, so no synchronization is needed.
+class ModelMatrixArena {
+public:
+
+    // Return a (dataDim, amplitudeDim) matrix view into the reused buffer.
+    // The view is only valid until the next call on this arena.
+    ndarray::Array<Pixel,2,-1> get(int dataDim, int amplitudeDim) {
+        if (_matrix.getSize<0>() < static_cast<std::size_t>(amplitudeDim)
+            || _matrix.getSize<1>() < static_cast<std::size_t>(dataDim)) {
+            _matrix = ndarray::allocate(
+                std::max<std::size_t>(amplitudeDim, _matrix.getSize<0>()),
+                std::max<std::size_t>(dataDim, _matrix.getSize<1>())
+            );
+        }
+        ndarray::Array<Pixel,2,1> matrixT = _matrix[ndarray::view(0, amplitudeDim)(0, dataDim)];
+        return matrixT.transpose();
+    }
+
+private:
+    ndarray::Array<Pixel,2,2> _matrix;
+};
+
+// utility function to create a model matrix: grabs recycled storage from the
+// arena and calls the likelihood object to do the work.
 ndarray::Array<Pixel,2,-1> makeModelMatrix(
     Likelihood const & likelihood,
-    ndarray::Array<Scalar const,1,1> const & nonlinear
+    ndarray::Array<Scalar const,1,1> const & nonlinear,
+    ModelMatrixArena & arena
 ) {
-    ndarray::Array<Pixel,2,2> modelMatrixT
-        = ndarray::allocate(likelihood.getAmplitudeDim(), likelihood.getDataDim());
-    ndarray::Array<Pixel,2,-1> modelMatrix = modelMatrixT.transpose();
+    ndarray::Array<Pixel,2,-1> modelMatrix
+        = arena.get(likelihood.getDataDim(), likelihood.getAmplitudeDim());
     likelihood.computeModelMatrix(modelMatrix, nonlinear, false);
     return modelMatrix;
 }
 
+// Adds elapsed wall-clock seconds to a counter when it goes out of scope, so the
+// performance counters stay correct across the many early returns (and exceptions)
+// in the measurement entry points.
+class ScopedTimeAccumulator {
+public:
+
+    explicit ScopedTimeAccumulator(Scalar & target) :
+        _target(target), _start(daf::base::DateTime::now().nsecs()) {}
+
+    ~ScopedTimeAccumulator() {
+        _target += (daf::base::DateTime::now().nsecs() - _start)/1E9;
+    }
+
+private:
+    Scalar & _target;
+    long long _start;
+};
+
 
 struct WeightSums {
 
@@ -637,18 +903,63 @@ struct WeightSums {
         run(model, data, variance);
     }
 
+    // Compute the same sums algebraically from fused normal-equations terms and an
+    // amplitude vector, without ever materializing the model-value vector.
+    WeightSums(
+        Likelihood::FitStatistics const & stats,
+        Vector const & amplitudes
+    ) : instFluxInner(0.0), fluxVar(0.0), norm(0.0)
+    {
+        double w = stats.modelSum.dot(amplitudes);
+        double wd = stats.modelDotData.dot(amplitudes);
+        double ww = amplitudes.dot(stats.modelSquared * amplitudes);
+        double wwv = amplitudes.dot(stats.modelSquaredVariance * amplitudes);
+        norm = w/ww;
+        instFluxInner = wd*norm;
+        fluxVar = wwv*norm*norm;
+    }
+
     void run(
         ndarray::Array<Pixel const,1,1> const & model,
         ndarray::Array<Pixel const,1,1> const & data,
         ndarray::Array<Pixel const,1,1> const & variance
     ) {
+        // Fused single-pass kernel: all four sums are accumulated together in
+        // fixed-size blocks, so the pixel vectors are traversed once instead of
+        // four times and the per-lane multiply-add chains map onto vector FMA
+        // instructions.  Accumulating in double also improves on the float
+        // accumulation of the separate Eigen reductions this replaces.
         auto modelEigen = ndarray::asEigenArray(model);
         auto dataEigen = ndarray::asEigenArray(data);
         auto varianceEigen = ndarray::asEigenArray(variance);
-        double w = modelEigen.sum();
-        double wd = (modelEigen*dataEigen).sum();
-        double ww = modelEigen.square().sum();
-        double wwv = (modelEigen.square()*varianceEigen).sum();
+        constexpr int BlockSize = 8;
+        int const size = modelEigen.size();
+        int const blockedSize = size - size % BlockSize;
+        Eigen::Array<double,BlockSize,1> wAcc = Eigen::Array<double,BlockSize,1>::Zero();
+        Eigen::Array<double,BlockSize,1> wdAcc = Eigen::Array<double,BlockSize,1>::Zero();
+        Eigen::Array<double,BlockSize,1> wwAcc = Eigen::Array<double,BlockSize,1>::Zero();
+        Eigen::Array<double,BlockSize,1> wwvAcc = Eigen::Array<double,BlockSize,1>::Zero();
+        for (int i = 0; i < blockedSize; i += BlockSize) {
+            Eigen::Array<double,BlockSize,1> const m
+                = modelEigen.segment<BlockSize>(i).cast<double>();
+            Eigen::Array<double,BlockSize,1> const mm = m*m;
+            wAcc += m;
+            wdAcc += m*dataEigen.segment<BlockSize>(i).cast<double>();
+            wwAcc += mm;
+            wwvAcc += mm*varianceEigen.segment<BlockSize>(i).cast<double>();
+        }
+        double w = wAcc.sum();
+        double wd = wdAcc.sum();
+        double ww = wwAcc.sum();
+        double wwv = wwvAcc.sum();
+        for (int i = blockedSize; i < size; ++i) {
+            double const m = modelEigen[i];
+            double const mm = m*m;
+            w += m;
+            wd += m*dataEigen[i];
+            ww += mm;
+            wwv += mm*varianceEigen[i];
+        }
         norm = w/ww;
         instFluxInner = wd*norm;
         fluxVar = wwv*norm*norm;
@@ -670,6 +981,8 @@ public:
     std::shared_ptr<Model> model;                        // defition of parameters, and how to map to Gaussians
     std::shared_ptr<Prior> prior;                        // Bayesian prior on parameters
     mutable Model::EllipseVector ellipses;   // workspace for asking Model to turn parameters into ellipses
+    mutable ModelMatrixArena matrixArena;    // recycled storage for per-source model matrices
+    mutable CModelStageStats stats;          // performance counters, accumulated over all fits
     std::shared_ptr<afw::table::BaseTable> historyTable;       // optimizer trace Table object
     std::shared_ptr<OptimizerHistoryRecorder> historyRecorder; // optimizer trace keys/handler
 
@@ -718,29 +1031,43 @@ public:
         result.ellipse = ellipses.front().getCore().transform(data.fitSysToMeasSys.geometric.getLinear());
     }
 
-    // Do the full nonlinear fit for this stage
+    // Do the full nonlinear fit for this stage.  If a likelihood over the same pixel
+    // region with the same weighting settings already exists (from a previous stage),
+    // it may be passed as `reuse` to share its pixel data instead of re-extracting it.
+    // If `checkpoint` is non-null (and dimensioned for this stage's model), the optimizer
+    // is warm-started from it instead of the moments-based guess in `data`.
     void fit(
         CModelStageControl const & ctrl, CModelStageResult & result, CModelStageData const & data,
-        afw::image::Exposure<Pixel> const & exposure, afw::detection::Footprint const & footprint
+        afw::image::Exposure<Pixel> const & exposure, afw::detection::Footprint const & footprint,
+        UnitTransformedLikelihood const * reuse = nullptr,
+        OptimizerCheckpoint const * checkpoint = nullptr
     ) const {
-        long long startTime = 0;
-        if (ctrl.doRecordTime) {
-            startTime = daf::base::DateTime::now().nsecs();
+        long long startTime = daf::base::DateTime::now().nsecs();
+        if (reuse) {
+            result.likelihood = std::make_shared<UnitTransformedLikelihood>(model, data.fixed, *reuse);
+        } else {
+            result.likelihood = std::make_shared<UnitTransformedLikelihood>(
+                model, data.fixed, data.fitSys, data.position,
+                exposure, footprint, data.psf,
+                UnitTransformedLikelihoodControl(ctrl.usePixelWeights, ctrl.weightsMultiplier)
+            );
         }
-        result.likelihood = std::make_shared<UnitTransformedLikelihood>(
-            model, data.fixed, data.fitSys, data.position,
-            exposure, footprint, data.psf,
-            UnitTransformedLikelihoodControl(ctrl.usePixelWeights, ctrl.weightsMultiplier)
-        );
         std::shared_ptr<OptimizerObjective> objective = OptimizerObjective::makeFromLikelihood(result.likelihood, prior);
         result.objfunc = objective;
-        Optimizer optimizer(objective, data.parameters, ctrl.optimizer);
+        if (checkpoint &&
+            checkpoint->parameters.getSize<0>() != data.parameters.getSize<0>()) {
+            checkpoint = nullptr;  // checkpoint from a different model configuration; ignore it
+        }
+        Optimizer optimizer = checkpoint
+            ? Optimizer(objective, *checkpoint, ctrl.optimizer)
+            : Optimizer(objective, data.parameters, ctrl.optimizer);
+        int iterCount = 0;
         try {
             if (ctrl.doRecordHistory) {
                 result.history = afw::table::BaseCatalog(historyTable);
-                optimizer.run(*historyRecorder, result.history);
+                iterCount = optimizer.run(*historyRecorder, result.history);
             } else {
-                optimizer.run();
+                iterCount = optimizer.run();
             }
         } catch (std::overflow_error &) {
             result.flags[CModelStageResult::NUMERIC_ERROR] = true;
@@ -771,6 +1098,7 @@ public:
         }
 
         result.objective = optimizer.getObjectiveValue();
+        result.checkpoint = std::make_shared<OptimizerCheckpoint>(optimizer.getCheckpoint());
 
         // Set the output parameter vectors.  We deep-assign to the data object to split nonlinear and
         // amplitudes, then shallow-assign these to the result object.
@@ -780,7 +1108,8 @@ public:
         // the best-fit model as a continuous aperture.  That's likely what we'd want for colors, but it
         // underestimates the statistical uncertainty on the total flux (though that's probably dominated by
         // systematic errors anyway).
-        ndarray::Array<Pixel,2,-1> modelMatrix = makeModelMatrix(*result.likelihood, data.nonlinear);
+        ndarray::Array<Pixel,2,-1> modelMatrix =
+            makeModelMatrix(*result.likelihood, data.nonlinear, matrixArena);
         WeightSums sums(
             modelMatrix,
             result.likelihood->getUnweightedData(),
@@ -801,33 +1130,42 @@ public:
         // Set parameter vectors, flux values, ellipse on result.
         fillResult(result, data, sums);
 
+        ++stats.fitCount;
+        stats.iterationCount += iterCount;
+        stats.modelMatrixCount += result.likelihood->getModelMatrixCount();
+        Scalar elapsed = (daf::base::DateTime::now().nsecs() - startTime)/1E9;
+        stats.time += elapsed;
         if (ctrl.doRecordTime) {
-            result.time = (daf::base::DateTime::now().nsecs() - startTime)/1E9;
+            result.time = elapsed;
         }
     }
 
-    // Do a linear-only fit for this stage (used only in forced mode)
+    // Do a linear-only fit for this stage (used in forced mode and by the faint-source
+    // fast path).  As in fit(), `reuse` may point to a likelihood over the same pixel
+    // region with matching weighting settings whose pixel data should be shared.
     void fitLinear(
         CModelStageControl const & ctrl, CModelStageResult & result, CModelStageData const & data,
-        afw::image::Exposure<Pixel> const & exposure, afw::detection::Footprint const & footprint
+        afw::image::Exposure<Pixel> const & exposure, afw::detection::Footprint const & footprint,
+        UnitTransformedLikelihood const * reuse = nullptr
     ) const {
-        result.likelihood = std::make_shared<UnitTransformedLikelihood>(
-            model, data.fixed, data.fitSys, data.position,
-            exposure, footprint, data.psf, UnitTransformedLikelihoodControl(ctrl.usePixelWeights)
-        );
-        ndarray::Array<Pixel,2,-1> modelMatrix = makeModelMatrix(*result.likelihood, data.nonlinear);
-        afw::math::LeastSquares lstsq = afw::math::LeastSquares::fromDesignMatrix(
-            modelMatrix,
-            result.likelihood->getUnweightedData()
-        );
-        data.amplitudes.deep() = lstsq.getSolution();
-        result.objective =
-                0.5 * (ndarray::asEigenMatrix(result.likelihood->getUnweightedData()).cast<Scalar>() -
-                       ndarray::asEigenMatrix(modelMatrix).cast<Scalar>() *
-                               ndarray::asEigenMatrix(data.amplitudes))
-                              .squaredNorm();
+        if (reuse) {
+            result.likelihood = std::make_shared<UnitTransformedLikelihood>(model, data.fixed, *reuse);
+        } else {
+            result.likelihood = std::make_shared<UnitTransformedLikelihood>(
+                model, data.fixed, data.fitSys, data.position,
+                exposure, footprint, data.psf, UnitTransformedLikelihoodControl(ctrl.usePixelWeights)
+            );
+        }
+        // Amplitude-only fit: the fused statistics are sufficient for the normal-equations
+        // solution, the objective, and the flux sums, so we never build the model matrix.
+        Likelihood::FitStatistics stats = result.likelihood->computeFitStatistics(data.nonlinear);
+        Vector amplitudes = stats.modelSquared.ldlt().solve(stats.modelDotData);
+        ndarray::asEigenMatrix(data.amplitudes) = amplitudes;
+        result.objective = 0.5 * (stats.dataSquaredNorm
+                                  - 2.0*stats.modelDotData.dot(amplitudes)
+                                  + amplitudes.dot(stats.modelSquared * amplitudes));
 
-        WeightSums sums(modelMatrix, result.likelihood->getUnweightedData(), result.likelihood->getVariance());
+        WeightSums sums(stats, amplitudes);
 
         fillResult(result, data, sums);
         result.flags[CModelStageResult::FAILED] = false;
@@ -852,9 +1190,34 @@ public:
                               // and extract shapelet PSF approximation.  May be null, depending
                               // on the CModelAlgorithm ctor called
     std::shared_ptr<CModelKeys> refKeys;  // Key object used to retreive reference ellipses in forced mode
+    mutable std::int64_t linearFitCount;  // number of final linear fits (performance counter)
+    mutable Scalar linearTime;            // accumulated seconds in the final linear fit
+    mutable Scalar totalTime;             // accumulated seconds over full per-source measurements
+    mutable bool profilingEnabled;        // whether to collect per-source profiling records
+    mutable std::vector<CModelSourceProfile> profiles;  // per-source records; measurement order for
+                                                        // measure(), per-worker order after a
+                                                        // threaded measureBatch merge
+    // Exposure-scoped cache of unit-system pieces, rebuilt only when the exposure's Wcs or
+    // PhotoCalib objects change; they are shared by all sources on a CCD.
+    mutable std::shared_ptr<UnitTransformCache> unitCache;
+    mutable afw::geom::SkyWcs const * unitCacheWcs;
+    mutable afw::image::PhotoCalib const * unitCachePhotoCalib;
+
+    UnitTransformCache const & getUnitCache(afw::image::Exposure<Pixel> const & exposure) const {
+        if (!unitCache || unitCacheWcs != exposure.getWcs().get()
+            || unitCachePhotoCalib != exposure.getPhotoCalib().get()) {
+            unitCache = std::make_shared<UnitTransformCache>(UnitSystem(exposure));
+            unitCacheWcs = exposure.getWcs().get();
+            unitCachePhotoCalib = exposure.getPhotoCalib().get();
+        }
+        return *unitCache;
+    }
 
     explicit Impl(CModelControl const & ctrl) :
-        initial(ctrl.initial), exp(ctrl.exp), dev(ctrl.dev)
+        initial(ctrl.initial), exp(ctrl.exp), dev(ctrl.dev),
+        linearFitCount(0), linearTime(0.0), totalTime(0.0),
+        profilingEnabled(false),
+        unitCacheWcs(nullptr), unitCachePhotoCalib(nullptr)
     {
         // construct linear combination model
         ModelVector components(2);
@@ -875,12 +1238,61 @@ public:
         return result;
     }
 
-    // Do the final two-component linear fit.
+    // Return the total optimizer iteration count over the three nonlinear stages; the
+    // per-source profiling sink differences this around each measurement.
+    std::int64_t totalIterationCount() const {
+        return initial.stats.iterationCount + exp.stats.iterationCount + dev.stats.iterationCount;
+    }
+
+    // Fold the performance counters (and any per-source profiling records) accumulated
+    // by a measureBatch worker's Impl back into this one, so getStats() and
+    // getSourceProfiles() on the parent algorithm cover batch runs the same way they
+    // cover measure().
+    void mergeCountersFrom(Impl const & other) const {
+        auto addStage = [](CModelStageStats & lhs, CModelStageStats const & rhs) {
+            lhs.fitCount += rhs.fitCount;
+            lhs.iterationCount += rhs.iterationCount;
+            lhs.modelMatrixCount += rhs.modelMatrixCount;
+            lhs.time += rhs.time;
+        };
+        addStage(initial.stats, other.initial.stats);
+        addStage(exp.stats, other.exp.stats);
+        addStage(dev.stats, other.dev.stats);
+        linearFitCount += other.linearFitCount;
+        linearTime += other.linearTime;
+        totalTime += other.totalTime;
+        profiles.insert(profiles.end(), other.profiles.begin(), other.profiles.end());
+    }
+
+    // Append a per-source profiling record; called on both the success and failure
+    // paths of _measureImpl and measureBatch's per-source compute when profiling is
+    // enabled.
+    void recordProfile(
+        afw::table::SourceRecord const & record, CModelResult const & result,
+        long long startNsecs, std::int64_t startIterations
+    ) const {
+        CModelSourceProfile profile;
+        profile.id = record.getId();
+        profile.time = (daf::base::DateTime::now().nsecs() - startNsecs)/1E9;
+        profile.iterationCount = totalIterationCount() - startIterations;
+        if (record.getFootprint()) {
+            profile.footprintArea = record.getFootprint()->getArea();
+        }
+        profile.flags = result.flags;
+        profiles.push_back(profile);
+    }
+
+    // Do the final two-component linear fit.  As in CModelStageImpl::fit, `reuse` may point
+    // to a likelihood over the same pixel region with matching weighting settings whose
+    // pixel data should be shared instead of re-extracted.
     void fitLinear(
         CModelControl const & ctrl, CModelResult & result,
         CModelStageData const & expData, CModelStageData const & devData,
-        afw::image::Exposure<Pixel> const & exposure, afw::detection::Footprint const & footprint
+        afw::image::Exposure<Pixel> const & exposure, afw::detection::Footprint const & footprint,
+        UnitTransformedLikelihood const * reuse = nullptr
     ) const {
+        ScopedTimeAccumulator timer(linearTime);
+        ++linearFitCount;
         // concatenate exp and dev parameter arrays to make parameter arrays for combined model
         ndarray::Array<Scalar,1,1> nonlinear = ndarray::allocate(model->getNonlinearDim());
         nonlinear[ndarray::view(0, exp.model->getNonlinearDim())] = expData.nonlinear;
@@ -889,19 +1301,22 @@ public:
         fixed[ndarray::view(0, exp.model->getFixedDim())] = expData.fixed;
         fixed[ndarray::view(exp.model->getFixedDim(), model->getFixedDim())] = devData.fixed;
 
-        UnitTransformedLikelihood likelihood(
-            model, fixed, expData.fitSys, expData.position,
-            exposure, footprint, expData.psf, UnitTransformedLikelihoodControl(false)
-        );
-        auto unweightedData = likelihood.getUnweightedData();
-        ndarray::Array<Pixel, 2, -1> modelMatrix = makeModelMatrix(likelihood, nonlinear);
-        Vector gradient = -(ndarray::asEigenMatrix(modelMatrix).adjoint() *
-                            ndarray::asEigenMatrix(unweightedData))
-                                   .cast<Scalar>();
-        Matrix hessian = Matrix::Zero(likelihood.getAmplitudeDim(), likelihood.getAmplitudeDim());
-        hessian.selfadjointView<Eigen::Lower>().rankUpdate(
-                ndarray::asEigenMatrix(modelMatrix).adjoint().cast<Scalar>());
-        Scalar q0 = 0.5 * ndarray::asEigenMatrix(unweightedData).squaredNorm();
+        std::shared_ptr<UnitTransformedLikelihood> likelihoodPtr;
+        if (reuse) {
+            likelihoodPtr = std::make_shared<UnitTransformedLikelihood>(model, fixed, *reuse);
+        } else {
+            likelihoodPtr = std::make_shared<UnitTransformedLikelihood>(
+                model, fixed, expData.fitSys, expData.position,
+                exposure, footprint, expData.psf, UnitTransformedLikelihoodControl(false)
+            );
+        }
+        UnitTransformedLikelihood & likelihood = *likelihoodPtr;
+        // Amplitude-only fit: accumulate the normal-equations terms in one fused pass
+        // instead of materializing the full dataDim x amplitudeDim model matrix.
+        Likelihood::FitStatistics stats = likelihood.computeFitStatistics(nonlinear);
+        Vector gradient = -stats.modelDotData;
+        Matrix hessian = stats.modelSquared;
+        Scalar q0 = 0.5 * stats.dataSquaredNorm;
 
         // Use truncated Gaussian to compute the maximum-likelihood amplitudes with the constraint
         // that all amplitude must be >= 0
@@ -921,9 +1336,7 @@ public:
         // Doing a better job would involve taking into account that we have positivity constraints
         // on the two components, which means the actual uncertainty is neither Gaussian nor symmetric,
         // which is a lot harder to compute and a lot harder to use.
-        ndarray::Array<Pixel,1,1> model = ndarray::allocate(likelihood.getDataDim());
-        ndarray::asEigenMatrix(model) = ndarray::asEigenMatrix(modelMatrix) * amplitudes.cast<Pixel>();
-        WeightSums sums(model, unweightedData, likelihood.getVariance());
+        WeightSums sums(stats, amplitudes);
         result.instFluxInner = sums.instFluxInner;
         result.instFluxErr = std::sqrt(sums.fluxVar)*result.instFlux/result.instFluxInner;
         if (result.instFluxInner == 0.0) {
@@ -1056,6 +1469,188 @@ CModelAlgorithm::CModelAlgorithm(Control const & ctrl) :
     _ctrl(ctrl), _impl(new Impl(ctrl))
 {}
 
+CModelAlgorithm::CModelAlgorithm(Control const & ctrl, std::shared_ptr<Impl> impl) :
+    _ctrl(ctrl), _impl(std::move(impl))
+{}
+
+void CModelAlgorithm::measureBatch(
+    afw::table::SourceCatalog & measCat,
+    afw::image::Exposure<Pixel> const & exposure,
+    int nThreads,
+    bool largestFirst
+) const {
+    if (!_impl->keys) {
+        throw LSST_EXCEPT(
+            meas::base::FatalAlgorithmError,
+            "Algorithm was not initialized with a schema; cannot run measureBatch"
+        );
+    }
+    // Buffer each source's full result (and any exception) so catalog output can be
+    // written in one column-major pass at the end, instead of scattering strided
+    // single-record writes through the middle of the compute loop.
+    std::size_t const nSources = measCat.size();
+    std::vector<Result> results(nSources);
+    std::vector<std::exception_ptr> errors(nSources);
+    auto computeOne = [&exposure, &results, &errors](
+        CModelAlgorithm const & algorithm, std::size_t index,
+        afw::table::SourceRecord & record, PrefetchedPixels const * prefetched
+    ) {
+        Result & result = results[index];
+        result = algorithm._impl->makeResult();
+        // Mirror the profiling instrumentation of _measureImpl; each worker records
+        // into its own Impl, and the records are merged back after the join below.
+        long long startNsecs = 0;
+        std::int64_t startIterations = 0;
+        if (algorithm._impl->profilingEnabled) {
+            startNsecs = daf::base::DateTime::now().nsecs();
+            startIterations = algorithm._impl->totalIterationCount();
+        }
+        try {
+            algorithm._computeMeasurement(record, exposure, prefetched, result);
+        } catch (...) {
+            errors[index] = std::current_exception();
+        }
+        if (algorithm._impl->profilingEnabled) {
+            algorithm._impl->recordProfile(record, result, startNsecs, startIterations);
+        }
+        // Drop per-source heavyweights (pixel buffers, optimizer state) that aren't
+        // needed for catalog output, so buffering a whole catalog of results doesn't
+        // pin them all in memory.
+        for (CModelStageResult * stage : {&result.initial, &result.exp, &result.dev}) {
+            stage->likelihood.reset();
+            stage->objfunc.reset();
+            stage->checkpoint.reset();
+        }
+    };
+    if (nThreads <= 1 || nSources < 2) {
+        for (std::size_t i = 0; i < nSources; ++i) {
+            computeOne(*this, i, measCat[i], nullptr);
+        }
+    } else {
+        // Pipelined mode: a dedicated producer thread pre-extracts each source's pixel
+        // buffers (memory-latency bound) into a bounded queue, and the fit workers pull
+        // from the queue and run the compute-bound fits, so neither phase stalls the
+        // other.  The queue bound keeps the producer from running arbitrarily far ahead
+        // and holding pixel copies for the whole catalog.
+        int const nWorkers = std::min<std::size_t>(nThreads, nSources);
+        std::size_t const maxQueued = 2*static_cast<std::size_t>(nWorkers);
+        // Cost-aware scheduling: dispatch sources largest-first, using the detection
+        // footprint area as the cost estimate, so the handful of giant footprints that
+        // dominate per-CCD runtime start immediately instead of landing on an
+        // almost-drained pool and leaving the other workers idle at the end.  Results
+        // are buffered by catalog index, so the processing order doesn't affect the
+        // output or the failure replay below.
+        std::vector<std::size_t> order(nSources);
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        if (largestFirst) {
+            std::vector<std::size_t> cost(nSources, 0);
+            for (std::size_t i = 0; i < nSources; ++i) {
+                if (measCat[i].getFootprint()) {
+                    cost[i] = measCat[i].getFootprint()->getArea();
+                }
+            }
+            std::stable_sort(
+                order.begin(), order.end(),
+                [&cost](std::size_t a, std::size_t b) { return cost[a] > cost[b]; }
+            );
+        }
+        std::mutex mutex;
+        std::condition_variable notEmpty;
+        std::condition_variable notFull;
+        std::deque<std::pair<std::size_t, PrefetchedPixels>> queue;
+        bool producerDone = false;
+        auto makeWorker = [this]() {
+            // Each worker (and the producer) gets its own Impl (and hence its own
+            // per-stage optimizer scratch state and unit-system cache), sharing only
+            // the immutable key objects.  Counters and profiling records land in the
+            // worker Impls and are folded back into this instance after the join.
+            auto workerImpl = std::make_shared<Impl>(_ctrl);
+            workerImpl->keys = _impl->keys;
+            workerImpl->refKeys = _impl->refKeys;
+            workerImpl->profilingEnabled = _impl->profilingEnabled;
+            return CModelAlgorithm(_ctrl, std::move(workerImpl));
+        };
+        CModelAlgorithm producerAlgorithm = makeWorker();
+        std::thread producer(
+            [producerAlgorithm, &measCat, &exposure, &mutex, &notEmpty, &notFull, &queue,
+             &producerDone, &order, nSources, maxQueued] {
+                for (std::size_t k = 0; k < nSources; ++k) {
+                    std::size_t const i = order[k];
+                    PrefetchedPixels prefetched;
+                    try {
+                        prefetched = producerAlgorithm._prefetchPixels(measCat[i], exposure);
+                    } catch (...) {
+                        // Leave the prefetch empty; the fit will hit (and flag) the
+                        // same problem itself.
+                    }
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        notFull.wait(lock, [&queue, maxQueued] { return queue.size() < maxQueued; });
+                        queue.emplace_back(i, std::move(prefetched));
+                    }
+                    notEmpty.notify_one();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    producerDone = true;
+                }
+                notEmpty.notify_all();
+            }
+        );
+        std::vector<std::thread> threads;
+        threads.reserve(nWorkers);
+        std::vector<CModelAlgorithm> workerAlgorithms;
+        workerAlgorithms.reserve(nWorkers);
+        for (int t = 0; t < nWorkers; ++t) {
+            workerAlgorithms.push_back(makeWorker());
+            CModelAlgorithm worker = workerAlgorithms.back();  // shares the worker's Impl
+            threads.emplace_back(
+                [worker, &measCat, &computeOne, &mutex, &notEmpty, &notFull, &queue, &producerDone] {
+                    while (true) {
+                        std::pair<std::size_t, PrefetchedPixels> item;
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            notEmpty.wait(lock, [&queue, &producerDone] {
+                                return !queue.empty() || producerDone;
+                            });
+                            if (queue.empty()) break;
+                            item = std::move(queue.front());
+                            queue.pop_front();
+                        }
+                        notFull.notify_one();
+                        computeOne(worker, item.first, measCat[item.first], &item.second);
+                    }
+                }
+            );
+        }
+        producer.join();
+        for (auto & thread : threads) { thread.join(); }
+        // Fold each worker's counters (and profiling records, when enabled) back into
+        // this instance, so getStats() reflects the whole catalog as its docs promise.
+        // The producer never runs fits, so it has nothing to contribute.
+        for (auto const & workerAlgorithm : workerAlgorithms) {
+            _impl->mergeCountersFrom(*workerAlgorithm._impl);
+        }
+    }
+    // One contiguous pass per output column, then per-record flag words.
+    _impl->keys->copyResultsToCatalog(results, measCat);
+    // Replay deferred failures in catalog order, mirroring the failure handling the
+    // measurement framework plugin does per record: flag the source and move on, so
+    // one bad source doesn't abort the whole catalog.
+    for (std::size_t i = 0; i < nSources; ++i) {
+        try {
+            _impl->checkFlagDetails(measCat[i]);
+            if (errors[i]) {
+                std::rethrow_exception(errors[i]);
+            }
+        } catch (meas::base::MeasurementError & err) {
+            fail(measCat[i], &err);
+        } catch (...) {
+            fail(measCat[i], nullptr);
+        }
+    }
+}
+
 CModelAlgorithm::Result CModelAlgorithm::apply(
     afw::image::Exposure<Pixel> const & exposure,
     shapelet::MultiShapeletFunction const & psf,
@@ -1063,10 +1658,11 @@ CModelAlgorithm::Result CModelAlgorithm::apply(
     afw::geom::ellipses::Quadrupole const & moments,
     Scalar approxFlux,
     Scalar kronRadius,
-    int footprintArea
+    int footprintArea,
+    Result const * warmStart
 ) const {
     Result result = _impl->makeResult();
-    _applyImpl(result, exposure, psf, center, moments, approxFlux, kronRadius, footprintArea);
+    _applyImpl(result, exposure, psf, center, moments, approxFlux, kronRadius, footprintArea, warmStart);
     return result;
 }
 
@@ -1078,8 +1674,11 @@ void CModelAlgorithm::_applyImpl(
     afw::geom::ellipses::Quadrupole const & moments,
     Scalar approxFlux,
     Scalar kronRadius,
-    int footprintArea
+    int footprintArea,
+    Result const * warmStart,
+    PrefetchedPixels const * prefetched
 ) const {
+    ScopedTimeAccumulator timer(_impl->totalTime);
 
     afw::geom::ellipses::Quadrupole psfMoments;
     try {
@@ -1122,15 +1721,27 @@ void CModelAlgorithm::_applyImpl(
     }
 
     // Set up coordinate systems and empty parameter vectors
-    CModelStageData initialData(exposure, approxFlux, center, psf, *_impl->initial.model);
+    CModelStageData initialData(exposure, _impl->getUnitCache(exposure), approxFlux, center,
+                                psf, *_impl->initial.model);
     result.fitSysToMeasSys = initialData.fitSysToMeasSys;
 
     // Initialize the parameter vectors by doing deconvolving the moments
     _impl->guessParametersFromMoments(getControl(), initialData, moments, result);
 
+    // If the producer pre-extracted this source's pixels and they cover exactly the
+    // region just computed, share its buffers instead of re-reading the exposure;
+    // the producer replayed the same deterministic region logic, so the spans only
+    // differ if the inputs changed underneath us.
+    UnitTransformedLikelihood const * initialReuse = nullptr;
+    if (prefetched && prefetched->likelihood && prefetched->footprint
+        && *region.footprint->getSpans() == *prefetched->footprint->getSpans()) {
+        initialReuse = prefetched->likelihood.get();
+    }
+
     // Do the initial fit
     // TODO: use only 0th-order terms in psf
-    _impl->initial.fit(getControl().initial, result.initial, initialData, exposure, *region.footprint);
+    _impl->initial.fit(getControl().initial, result.initial, initialData, exposure, *region.footprint,
+                       initialReuse, warmStart ? warmStart->initial.checkpoint.get() : nullptr);
     if (result.initial.flags[CModelStageResult::FAILED]) return;
 
     // Include a multiple of the initial-fit ellipse in the footprint, re-do clipping
@@ -1139,6 +1750,7 @@ void CModelAlgorithm::_applyImpl(
     _impl->initial.ellipses.front().transform(initialData.fitSysToMeasSys.geometric).inPlace();
 
     // Revisit the pixel region to use in the fit, taking into account the initial ellipse
+    std::shared_ptr<afw::detection::Footprint> initialFootprint = region.footprint;
     region.applyEllipse(_impl->initial.ellipses.front().getCore(), psfMoments);
     result.finalFitRegion = region.ellipse;
     region.applyMask(*exposure.getMaskedImage().getMask(), center);
@@ -1149,20 +1761,79 @@ void CModelAlgorithm::_applyImpl(
     result.flags[CModelResult::REGION_USED_INITIAL_ELLIPSE_MAX] = region.usedMaxEllipse;
     if (!region.footprint) return;
 
+    // When the revisited region covers exactly the same pixels as the initial one and a stage's
+    // weighting settings match those of an earlier fit, the earlier likelihood's pixel data can
+    // be shared instead of re-extracted from the exposure (see the pixel-data-sharing
+    // UnitTransformedLikelihood constructor).
+    bool const sameRegion = *region.footprint->getSpans() == *initialFootprint->getSpans();
+    auto sameWeighting = [](CModelStageControl const & a, CModelStageControl const & b) {
+        return a.usePixelWeights == b.usePixelWeights && a.weightsMultiplier == b.weightsMultiplier;
+    };
+
+    // Fast path for faint, small sources: the exp and dev stages land on nearly identical
+    // ellipses near the detection limit, so we cap the exp stage's iterations and replace
+    // the dev nonlinear fit with an amplitude-only fit at the exp ellipse.
+    bool fastPath = false;
+    if (getControl().fastPathSNThreshold > 0.0 && result.initial.instFluxErr > 0.0) {
+        Scalar const sn = result.initial.instFlux/result.initial.instFluxErr;
+        fastPath = sn < getControl().fastPathSNThreshold
+            && result.initial.ellipse.getDeterminantRadius() < getControl().fastPathRadiusThreshold;
+    }
+
     // Do the exponential fit
     CModelStageData expData = initialData.changeModel(*_impl->exp.model);
-    _impl->exp.fit(getControl().exp, result.exp, expData, exposure, *region.footprint);
+    UnitTransformedLikelihood const * expReuse =
+        (sameRegion && sameWeighting(getControl().initial, getControl().exp))
+        ? dynamic_cast<UnitTransformedLikelihood const *>(result.initial.likelihood.get())
+        : nullptr;
+    OptimizerCheckpoint const * expCheckpoint =
+        warmStart ? warmStart->exp.checkpoint.get() : nullptr;
+    if (fastPath) {
+        CModelStageControl expCtrl(getControl().exp);
+        expCtrl.optimizer.maxOuterIterations = std::min(
+            expCtrl.optimizer.maxOuterIterations, getControl().fastPathMaxOuterIterations
+        );
+        _impl->exp.fit(expCtrl, result.exp, expData, exposure, *region.footprint, expReuse,
+                       expCheckpoint);
+    } else {
+        _impl->exp.fit(getControl().exp, result.exp, expData, exposure, *region.footprint, expReuse,
+                       expCheckpoint);
+    }
 
-    // Do the de Vaucouleur fit
-    CModelStageData devData = initialData.changeModel(*_impl->dev.model);
-    _impl->dev.fit(getControl().dev, result.dev, devData, exposure, *region.footprint);
+    // Do the de Vaucouleur fit; the exp and dev stages always share the same footprint,
+    // so only the weighting settings need to match for pixel-data reuse.  On the fast
+    // path the dev stage starts from (and keeps) the exp stage's fitted parameters.
+    bool const devLinearOnly = fastPath && !result.exp.flags[CModelStageResult::FAILED];
+    CModelStageData devData =
+        (devLinearOnly ? expData : initialData).changeModel(*_impl->dev.model);
+    UnitTransformedLikelihood const * devReuse =
+        sameWeighting(getControl().exp, getControl().dev)
+        ? dynamic_cast<UnitTransformedLikelihood const *>(result.exp.likelihood.get())
+        : nullptr;
+    if (devLinearOnly) {
+        // fitLinear builds its likelihood with a unit weights multiplier, so reuse is only
+        // valid if the exp stage used one too.
+        _impl->dev.fitLinear(
+            getControl().dev, result.dev, devData, exposure, *region.footprint,
+            getControl().exp.weightsMultiplier == 1.0 ? devReuse : nullptr
+        );
+    } else {
+        _impl->dev.fit(getControl().dev, result.dev, devData, exposure, *region.footprint, devReuse,
+                       warmStart ? warmStart->dev.checkpoint.get() : nullptr);
+    }
 
     if (result.exp.flags[CModelStageResult::FAILED] ||result.dev.flags[CModelStageResult::FAILED])
         return;
 
-    // Do the linear combination fit
+    // Do the linear combination fit; it always uses unweighted pixels, so the exp likelihood
+    // can only be shared if that stage was unweighted too.
+    UnitTransformedLikelihood const * linearReuse =
+        (!getControl().exp.usePixelWeights && getControl().exp.weightsMultiplier == 1.0)
+        ? dynamic_cast<UnitTransformedLikelihood const *>(result.exp.likelihood.get())
+        : nullptr;
     try {
-        _impl->fitLinear(getControl(), result, expData, devData, exposure, *region.footprint);
+        _impl->fitLinear(getControl(), result, expData, devData, exposure, *region.footprint,
+                         linearReuse);
     } catch (...) {
         result.flags[CModelResult::FAILED] = true;
         throw;
@@ -1194,6 +1865,119 @@ void CModelAlgorithm::writeResultToRecord(
     _impl->keys->copyResultToRecord(result, record);
 }
 
+CModelStats CModelAlgorithm::getStats() const {
+    CModelStats stats;
+    stats.initial = _impl->initial.stats;
+    stats.exp = _impl->exp.stats;
+    stats.dev = _impl->dev.stats;
+    stats.linearFitCount = _impl->linearFitCount;
+    stats.linearTime = _impl->linearTime;
+    stats.totalTime = _impl->totalTime;
+    return stats;
+}
+
+void CModelAlgorithm::resetStats() const {
+    _impl->initial.stats = CModelStageStats();
+    _impl->exp.stats = CModelStageStats();
+    _impl->dev.stats = CModelStageStats();
+    _impl->linearFitCount = 0;
+    _impl->linearTime = 0.0;
+    _impl->totalTime = 0.0;
+}
+
+void CModelAlgorithm::setProfilingEnabled(bool enabled) const {
+    _impl->profilingEnabled = enabled;
+}
+
+bool CModelAlgorithm::getProfilingEnabled() const {
+    return _impl->profilingEnabled;
+}
+
+std::vector<CModelSourceProfile> const & CModelAlgorithm::getSourceProfiles() const {
+    return _impl->profiles;
+}
+
+void CModelAlgorithm::clearSourceProfiles() const {
+    _impl->profiles.clear();
+}
+
+namespace {
+
+// Names for CModelResult::FlagBit values, in enum order; used by the profiling report.
+char const * const resultFlagNames[CModelResult::N_FLAGS] = {
+    "FAILED",
+    "REGION_MAX_AREA",
+    "REGION_MAX_BAD_PIXEL_FRACTION",
+    "REGION_USED_FOOTPRINT_AREA",
+    "REGION_USED_PSF_AREA",
+    "REGION_USED_INITIAL_ELLIPSE_MIN",
+    "REGION_USED_INITIAL_ELLIPSE_MAX",
+    "NO_SHAPE",
+    "SMALL_SHAPE",
+    "NO_SHAPELET_PSF",
+    "BAD_CENTROID",
+    "BAD_REFERENCE",
+    "NO_FLUX",
+};
+
+} // anonymous
+
+std::string CModelAlgorithm::formatProfileReport(int topN) const {
+    std::vector<CModelSourceProfile> const & profiles = _impl->profiles;
+    std::ostringstream os;
+    Scalar total = 0.0;
+    for (auto const & profile : profiles) {
+        total += profile.time;
+    }
+    os << (boost::format("CModel per-source profile: %d sources, %.3f s total\n")
+           % profiles.size() % total);
+    if (profiles.empty()) {
+        return os.str();
+    }
+    std::vector<Scalar> times;
+    times.reserve(profiles.size());
+    for (auto const & profile : profiles) {
+        times.push_back(profile.time);
+    }
+    std::sort(times.begin(), times.end());
+    auto percentile = [&times](double q) {
+        std::size_t index = static_cast<std::size_t>(q*(times.size() - 1) + 0.5);
+        return times[index];
+    };
+    os << (boost::format("time per source (s): p50=%.4f p90=%.4f p95=%.4f p99=%.4f max=%.4f\n")
+           % percentile(0.50) % percentile(0.90) % percentile(0.95) % percentile(0.99)
+           % times.back());
+    std::vector<CModelSourceProfile const *> slowest;
+    slowest.reserve(profiles.size());
+    for (auto const & profile : profiles) {
+        slowest.push_back(&profile);
+    }
+    std::size_t n = std::min<std::size_t>(std::max(topN, 0), slowest.size());
+    std::partial_sort(
+        slowest.begin(), slowest.begin() + n, slowest.end(),
+        [](CModelSourceProfile const * a, CModelSourceProfile const * b) {
+            return a->time > b->time;
+        }
+    );
+    os << "slowest sources:\n";
+    for (std::size_t i = 0; i < n; ++i) {
+        CModelSourceProfile const & profile = *slowest[i];
+        os << (boost::format("  id=%d time=%.4f iterations=%d footprintArea=%d flags=")
+               % profile.id % profile.time % profile.iterationCount % profile.footprintArea);
+        bool first = true;
+        for (int b = 0; b < CModelResult::N_FLAGS; ++b) {
+            if (profile.flags[b]) {
+                if (!first) os << ",";
+                os << resultFlagNames[b];
+                first = false;
+            }
+        }
+        if (first) os << "(none)";
+        os << "\n";
+    }
+    return os.str();
+}
+
 void CModelAlgorithm::fail(
     afw::table::SourceRecord & record,
     meas::base::MeasurementError * error
@@ -1218,6 +2002,7 @@ void CModelAlgorithm::_applyForcedImpl(
     CModelResult const & reference,
     Scalar approxFlux
 ) const {
+    ScopedTimeAccumulator timer(_impl->totalTime);
 
     if (reference.flags[CModelResult::FAILED]) {
         result.flags[CModelResult::BAD_REFERENCE] = true;
@@ -1256,7 +2041,8 @@ void CModelAlgorithm::_applyForcedImpl(
     }
 
     // Set up coordinate systems and empty parameter vectors
-    CModelStageData initialData(exposure, approxFlux, center, psf, *_impl->initial.model);
+    CModelStageData initialData(exposure, _impl->getUnitCache(exposure), approxFlux, center,
+                                psf, *_impl->initial.model);
     result.fitSysToMeasSys = initialData.fitSysToMeasSys;
 
     // Initialize the parameter vectors from the reference values.  Because these are
@@ -1265,6 +2051,14 @@ void CModelAlgorithm::_applyForcedImpl(
     initialData.nonlinear.deep() = reference.initial.nonlinear;
     initialData.fixed.deep() = reference.initial.fixed;
 
+    // All four forced-mode fits share the same footprint, so a stage's pixel data can be
+    // shared with any earlier likelihood built with the same weighting settings (fitLinear
+    // always uses a unit weights multiplier).  A null likelihood (skipped stage) simply
+    // yields no reuse.
+    auto asUnitTransformed = [](std::shared_ptr<Likelihood> const & likelihood) {
+        return dynamic_cast<UnitTransformedLikelihood const *>(likelihood.get());
+    };
+
     // Do the initial fit (amplitudes only)
     if (!reference.initial.flags[CModelStageResult::FAILED]) {
         _impl->initial.fitLinear(getControl().initial, result.initial, initialData,
@@ -1279,7 +2073,12 @@ void CModelAlgorithm::_applyForcedImpl(
     if (!reference.exp.flags[CModelStageResult::FAILED]) {
         expData.nonlinear.deep() = reference.exp.nonlinear;
         expData.fixed.deep() = reference.exp.fixed;
-        _impl->exp.fitLinear(getControl().exp, result.exp, expData, exposure, *region.footprint);
+        UnitTransformedLikelihood const * expReuse =
+            (getControl().initial.usePixelWeights == getControl().exp.usePixelWeights)
+            ? asUnitTransformed(result.initial.likelihood)
+            : nullptr;
+        _impl->exp.fitLinear(getControl().exp, result.exp, expData, exposure, *region.footprint,
+                             expReuse);
     } else {
         result.exp.flags[CModelStageResult::BAD_REFERENCE] = true;
         result.exp.flags[CModelStageResult::FAILED] = true;
@@ -1290,7 +2089,15 @@ void CModelAlgorithm::_applyForcedImpl(
     if (!reference.dev.flags[CModelStageResult::FAILED]) {
         devData.nonlinear.deep() = reference.dev.nonlinear;
         devData.fixed.deep() = reference.dev.fixed;
-        _impl->dev.fitLinear(getControl().dev, result.dev, devData, exposure, *region.footprint);
+        UnitTransformedLikelihood const * devReuse = nullptr;
+        if (getControl().exp.usePixelWeights == getControl().dev.usePixelWeights) {
+            devReuse = asUnitTransformed(result.exp.likelihood);
+        }
+        if (!devReuse && getControl().initial.usePixelWeights == getControl().dev.usePixelWeights) {
+            devReuse = asUnitTransformed(result.initial.likelihood);
+        }
+        _impl->dev.fitLinear(getControl().dev, result.dev, devData, exposure, *region.footprint,
+                             devReuse);
     } else {
         result.dev.flags[CModelStageResult::BAD_REFERENCE] = true;
         result.dev.flags[CModelStageResult::FAILED] = true;
@@ -1299,9 +2106,17 @@ void CModelAlgorithm::_applyForcedImpl(
     if (result.exp.flags[CModelStageResult::FAILED] || result.dev.flags[CModelStageResult::FAILED])
         return;
 
-    // Do the linear combination fit
+    // Do the linear combination fit; it always uses unweighted pixels.
+    UnitTransformedLikelihood const * linearReuse = nullptr;
+    if (!getControl().exp.usePixelWeights) {
+        linearReuse = asUnitTransformed(result.exp.likelihood);
+    }
+    if (!linearReuse && !getControl().dev.usePixelWeights) {
+        linearReuse = asUnitTransformed(result.dev.likelihood);
+    }
     try {
-        _impl->fitLinear(getControl(), result, expData, devData, exposure, *region.footprint);
+        _impl->fitLinear(getControl(), result, expData, devData, exposure, *region.footprint,
+                         linearReuse);
     } catch (...) {
         result.flags[CModelResult::FAILED] = true;
         throw;
@@ -1348,8 +2163,45 @@ shapelet::MultiShapeletFunction CModelAlgorithm::_processInputs(
 void CModelAlgorithm::measure(
     afw::table::SourceRecord & measRecord,
     afw::image::Exposure<Pixel> const & exposure
+) const {
+    _measureImpl(measRecord, exposure, nullptr);
+}
+
+void CModelAlgorithm::_measureImpl(
+    afw::table::SourceRecord & measRecord,
+    afw::image::Exposure<Pixel> const & exposure,
+    PrefetchedPixels const * prefetched
 ) const {
     Result result = _impl->makeResult();
+    long long startNsecs = 0;
+    std::int64_t startIterations = 0;
+    if (_impl->profilingEnabled) {
+        startNsecs = daf::base::DateTime::now().nsecs();
+        startIterations = _impl->totalIterationCount();
+    }
+    try {
+        _computeMeasurement(measRecord, exposure, prefetched, result);
+    } catch (...) {
+        if (_impl->profilingEnabled) {
+            _impl->recordProfile(measRecord, result, startNsecs, startIterations);
+        }
+        _impl->keys->copyResultToRecord(result, measRecord);
+        _impl->checkFlagDetails(measRecord);
+        throw;
+    }
+    if (_impl->profilingEnabled) {
+        _impl->recordProfile(measRecord, result, startNsecs, startIterations);
+    }
+    _impl->keys->copyResultToRecord(result, measRecord);
+    _impl->checkFlagDetails(measRecord);
+}
+
+void CModelAlgorithm::_computeMeasurement(
+    afw::table::SourceRecord & measRecord,
+    afw::image::Exposure<Pixel> const & exposure,
+    PrefetchedPixels const * prefetched,
+    Result & result
+) const {
     // Read the shapelet approximation to the PSF, load/verify other inputs from the SourceRecord
     shapelet::MultiShapeletFunction psf = _processInputs(measRecord, exposure);
     afw::geom::ellipses::Quadrupole moments;
@@ -1387,16 +2239,63 @@ void CModelAlgorithm::measure(
     if (_impl->keys->kronRadius.isValid() && measRecord.get(_impl->keys->kronRadius) > 0) {
         kronRadius = measRecord.get(_impl->keys->kronRadius);
     }
-    try {
-        _applyImpl(result, exposure, psf, measRecord.getCentroid(), moments, approxFlux, kronRadius,
-                   measRecord.getFootprint()->getArea());
-    } catch (...) {
-        _impl->keys->copyResultToRecord(result, measRecord);
-        _impl->checkFlagDetails(measRecord);
-        throw;
+    _applyImpl(result, exposure, psf, measRecord.getCentroid(), moments, approxFlux, kronRadius,
+               measRecord.getFootprint()->getArea(), nullptr, prefetched);
+}
+
+CModelAlgorithm::PrefetchedPixels CModelAlgorithm::_prefetchPixels(
+    afw::table::SourceRecord & measRecord,
+    afw::image::Exposure<Pixel> const & exposure
+) const {
+    PrefetchedPixels prefetched;
+    // Replay the input handling of measure() and the region determination of
+    // _applyImpl; any path that would end in a flagged failure just returns an
+    // empty struct, leaving the fitting pass to rediscover and record it.
+    shapelet::MultiShapeletFunction psf = _processInputs(measRecord, exposure);
+    afw::geom::ellipses::Quadrupole moments;
+    if (!measRecord.getTable()->getShapeSlot().getMeasKey().isValid() ||
+        (measRecord.getTable()->getShapeSlot().getFlagKey().isValid() && measRecord.getShapeFlag())) {
+        if (getControl().fallbackInitialMomentsPsfFactor > 0.0) {
+            moments = psf.evaluate().computeMoments().getCore();
+            moments.scale(getControl().fallbackInitialMomentsPsfFactor);
+        } else {
+            return prefetched;
+        }
+    } else {
+        moments = measRecord.getShape();
     }
-    _impl->keys->copyResultToRecord(result, measRecord);
-    _impl->checkFlagDetails(measRecord);
+    Scalar approxFlux = -1.0;
+    if (measRecord.getTable()->getPsfFluxSlot().isValid() && !measRecord.getPsfFluxFlag()) {
+        approxFlux = measRecord.getPsfInstFlux();
+    }
+    Scalar kronRadius = -1.0;
+    if (_impl->keys->kronRadius.isValid() && measRecord.get(_impl->keys->kronRadius) > 0) {
+        kronRadius = measRecord.get(_impl->keys->kronRadius);
+    }
+    geom::Point2D center = measRecord.getCentroid();
+    afw::geom::ellipses::Quadrupole psfMoments = psf.evaluate().computeMoments().getCore();
+    PixelFitRegion region(getControl().region, moments, psfMoments, kronRadius,
+                          measRecord.getFootprint()->getArea());
+    region.applyMask(*exposure.getMaskedImage().getMask(), center);
+    if (!region.footprint) return prefetched;
+    if (!(approxFlux > 0.0)) {
+        approxFlux = computeFluxInFootprint(*exposure.getMaskedImage().getImage(), *region.footprint);
+        if (!(approxFlux > 0.0)) return prefetched;
+    }
+    // The fixed parameters passed here are placeholders: the pixel extraction doesn't
+    // depend on them, and the pixel-data-sharing constructor used by the fit supplies
+    // the real ones.
+    CModelStageData data(exposure, _impl->getUnitCache(exposure), approxFlux, center, psf,
+                         *_impl->initial.model);
+    data.fixed.deep() = 0.0;
+    prefetched.footprint = region.footprint;
+    prefetched.likelihood = std::make_shared<UnitTransformedLikelihood>(
+        _impl->initial.model, data.fixed, data.fitSys, data.position, exposure, *region.footprint,
+        data.psf,
+        UnitTransformedLikelihoodControl(getControl().initial.usePixelWeights,
+                                         getControl().initial.weightsMultiplier)
+    );
+    return prefetched;
 }
 
 void CModelAlgorithm::measure(
@@ -148,6 +148,37 @@ private:
     geom::AffineTransform const * _gt;
 };
 
+// Flattened-pixel scratch arrays shared by the profile and shapelet fitting stages
+// of consecutive sources in measureBatch; grown when a larger PSF image is seen
+// and reused as-is otherwise (callers take views sized to the current image area).
+struct FitScratch {
+
+    FitScratch() : capacity(0) {}
+
+    void ensure(int area) {
+        if (capacity < area) {
+            x = ndarray::allocate(area);
+            y = ndarray::allocate(area);
+            data = ndarray::allocate(area);
+            arg = ndarray::allocate(area);
+            capacity = area;
+        }
+    }
+
+    int capacity;
+    ndarray::Array<Scalar,1,1> x;
+    ndarray::Array<Scalar,1,1> y;
+    ndarray::Array<Scalar,1,1> data;
+    ndarray::Array<Scalar,1,1> arg;
+};
+
+// Return true if two PSF kernel images cover the same bounding box and have
+// identical pixel values.
+bool isSameImage(afw::detection::Psf::Image const & a, afw::detection::Psf::Image const & b) {
+    return a.getBBox() == b.getBBox() &&
+        (ndarray::asEigenArray(a.getArray()) == ndarray::asEigenArray(b.getArray())).all();
+}
+
 } // anonymous
 
 
@@ -249,16 +280,21 @@ namespace {
 class ProfileObjective : public OptimizerObjective {
 public:
 
+    // When provided, data and arg are used as the backing storage for the flattened
+    // pixel values and precomputed Gaussian arguments (they must have size equal to
+    // the image area); otherwise fresh arrays are allocated.
     ProfileObjective(
         afw::geom::ellipses::Ellipse const & moments,
         DoubleShapeletPsfApproxControl const & ctrl,
-        afw::image::Image<Scalar> const & image
+        afw::image::Image<Scalar> const & image,
+        ndarray::Array<Scalar,1,1> const & data = ndarray::Array<Scalar,1,1>(),
+        ndarray::Array<Scalar,1,1> const & arg = ndarray::Array<Scalar,1,1>()
     ) : OptimizerObjective(image.getBBox().getArea(), 4),
         _minRadius(ctrl.minRadius),
         _maxRadius(ctrl.maxRadiusBoxFraction * std::sqrt(this->dataSize)),
         _minRadiusDiff(ctrl.minRadiusDiff),
-        _data(ndarray::Array<Scalar,1,1>(ndarray::allocate(this->dataSize))),
-        _arg(ndarray::Array<Scalar,1,1>(ndarray::allocate(this->dataSize)))
+        _data(data.isEmpty() ? ndarray::Array<Scalar,1,1>(ndarray::allocate(this->dataSize)) : data),
+        _arg(arg.isEmpty() ? ndarray::Array<Scalar,1,1>(ndarray::allocate(this->dataSize)) : arg)
     {
         // Radius parameters are defined as factors of the moments ellipse, so
         // we have to scale the constraints the same way.
@@ -332,24 +368,28 @@ private:
     ndarray::Array<Scalar,1,1> _arg;
 };
 
-} // anonymous
-
-std::shared_ptr<OptimizerObjective> DoubleShapeletPsfApproxAlgorithm::makeObjective(
-    afw::geom::ellipses::Ellipse const & moments,
-    Control const & ctrl,
-    afw::image::Image<Scalar> const & psfImage
-) {
-    return std::make_shared<ProfileObjective>(moments, ctrl, psfImage);
-}
-
-void DoubleShapeletPsfApproxAlgorithm::fitProfile(
+// Implementation of fitProfile, optionally backed by scratch arrays reused
+// across the sources of a measureBatch call.
+void fitProfileImpl(
     shapelet::MultiShapeletFunction & result,
-    Control const & ctrl,
-    afw::detection::Psf::Image const & psfImage
+    DoubleShapeletPsfApproxControl const & ctrl,
+    afw::detection::Psf::Image const & psfImage,
+    FitScratch * scratch
 ) {
     afw::geom::ellipses::Ellipse moments = result.evaluate().computeMoments();
     Scalar momentsRadius = moments.getCore().getDeterminantRadius();
-    auto objective = makeObjective(moments, ctrl, psfImage);
+    std::shared_ptr<OptimizerObjective> objective;
+    if (scratch) {
+        int const area = psfImage.getBBox().getArea();
+        scratch->ensure(area);
+        objective = std::make_shared<ProfileObjective>(
+            moments, ctrl, psfImage,
+            scratch->data[ndarray::view(0, area)],
+            scratch->arg[ndarray::view(0, area)]
+        );
+    } else {
+        objective = std::make_shared<ProfileObjective>(moments, ctrl, psfImage);
+    }
     ndarray::Array<Scalar,1,1> parameters = ndarray::allocate(objective->parameterSize);
     parameters[0] = result.getComponents()[0].getCoefficients()[0];
     parameters[1] = result.getComponents()[1].getCoefficients()[0];
@@ -367,7 +407,7 @@ void DoubleShapeletPsfApproxAlgorithm::fitProfile(
             throw LSST_EXCEPT(
                 meas::base::MeasurementError,
                 "Fitting profile failed; too many outer iterations",
-                MAX_ITERATIONS.number
+                DoubleShapeletPsfApproxAlgorithm::MAX_ITERATIONS.number
             );
         } else {
             throw LSST_EXCEPT(
@@ -380,10 +420,33 @@ void DoubleShapeletPsfApproxAlgorithm::fitProfile(
     }
 }
 
-void DoubleShapeletPsfApproxAlgorithm::fitShapelets(
+} // anonymous
+
+std::shared_ptr<OptimizerObjective> DoubleShapeletPsfApproxAlgorithm::makeObjective(
+    afw::geom::ellipses::Ellipse const & moments,
+    Control const & ctrl,
+    afw::image::Image<Scalar> const & psfImage
+) {
+    return std::make_shared<ProfileObjective>(moments, ctrl, psfImage);
+}
+
+void DoubleShapeletPsfApproxAlgorithm::fitProfile(
     shapelet::MultiShapeletFunction & result,
     Control const & ctrl,
     afw::detection::Psf::Image const & psfImage
+) {
+    fitProfileImpl(result, ctrl, psfImage, nullptr);
+}
+
+namespace {
+
+// Implementation of fitShapelets, optionally backed by scratch arrays reused
+// across the sources of a measureBatch call.
+void fitShapeletsImpl(
+    shapelet::MultiShapeletFunction & result,
+    DoubleShapeletPsfApproxControl const & ctrl,
+    afw::detection::Psf::Image const & psfImage,
+    FitScratch * scratch
 ) {
     if (result.getComponents().size() != 2u) {
         throw LSST_EXCEPT(
@@ -400,9 +463,19 @@ void DoubleShapeletPsfApproxAlgorithm::fitShapelets(
     // Create flattened coordinate arrays to pass to MatrixBuilders, while copying pixel values into
     // another flattened array.
     int area = psfImage.getBBox().getArea();
-    ndarray::Array<Scalar,1,1> xArray = ndarray::allocate(area);
-    ndarray::Array<Scalar,1,1> yArray = ndarray::allocate(area);
-    ndarray::Array<Scalar,1,1> data = ndarray::allocate(area);
+    ndarray::Array<Scalar,1,1> xArray;
+    ndarray::Array<Scalar,1,1> yArray;
+    ndarray::Array<Scalar,1,1> data;
+    if (scratch) {
+        scratch->ensure(area);
+        xArray = scratch->x[ndarray::view(0, area)];
+        yArray = scratch->y[ndarray::view(0, area)];
+        data = scratch->data[ndarray::view(0, area)];
+    } else {
+        xArray = ndarray::allocate(area);
+        yArray = ndarray::allocate(area);
+        data = ndarray::allocate(area);
+    }
     FlattenFunctor func(xArray, yArray, data);
     applyPixelFunctor(psfImage, func);
     // Construct two MatrixBuilders, using the pattern that lets them share workspace.
@@ -439,6 +512,16 @@ void DoubleShapeletPsfApproxAlgorithm::fitShapelets(
     }
 }
 
+} // anonymous
+
+void DoubleShapeletPsfApproxAlgorithm::fitShapelets(
+    shapelet::MultiShapeletFunction & result,
+    Control const & ctrl,
+    afw::detection::Psf::Image const & psfImage
+) {
+    fitShapeletsImpl(result, ctrl, psfImage, nullptr);
+}
+
 void DoubleShapeletPsfApproxAlgorithm::measure(
     afw::table::SourceRecord & measRecord,
     afw::image::Exposure<float> const & exposure
@@ -468,6 +551,58 @@ void DoubleShapeletPsfApproxAlgorithm::measure(
     measRecord.set(_key, result);
 }
 
+void DoubleShapeletPsfApproxAlgorithm::measureBatch(
+    afw::table::SourceCatalog & measCat,
+    afw::image::Exposure<float> const & exposure
+) const {
+    auto psf = exposure.getPsf();
+    if (!psf) {
+        throw LSST_EXCEPT(
+            meas::base::FatalAlgorithmError,
+            "No Psf attached to Exposure for DoubleShapeletPsfApprox."
+        );
+    }
+    FitScratch scratch;
+    std::shared_ptr<afw::detection::Psf::Image> lastImage;
+    shapelet::MultiShapeletFunction lastResult;
+    for (std::size_t i = 0; i < measCat.size(); ++i) {
+        afw::table::SourceRecord & record = measCat[i];
+        // Mirror the failure handling done by the measurement framework plugin: flag
+        // the source and move on, so one bad source doesn't abort the whole catalog.
+        try {
+            auto position = _centroidExtractor(record, _flagHandler);
+            std::shared_ptr<afw::detection::Psf::Image> psfImage;
+            try {
+                psfImage = psf->computeKernelImage(position);
+            } catch (pex::exceptions::Exception & err) {
+                throw LSST_EXCEPT(
+                    meas::base::MeasurementError,
+                    err.what(),
+                    INVALID_POINT_FOR_PSF.number
+                );
+            }
+            // In dense fields the PSF model is often constant (or piecewise constant)
+            // in position, so consecutive sources frequently realize bit-identical
+            // kernel images; the previous fit then applies as-is.
+            if (lastImage && isSameImage(*psfImage, *lastImage)) {
+                record.set(_key, lastResult);
+                continue;
+            }
+            auto result = initializeResult(_ctrl);
+            fitMoments(result, _ctrl, *psfImage);
+            fitProfileImpl(result, _ctrl, *psfImage, &scratch);
+            fitShapeletsImpl(result, _ctrl, *psfImage, &scratch);
+            record.set(_key, result);
+            lastImage = psfImage;
+            lastResult = result;
+        } catch (meas::base::MeasurementError & err) {
+            fail(record, &err);
+        } catch (...) {
+            fail(record, nullptr);
+        }
+    }
+}
+
 
 void DoubleShapeletPsfApproxAlgorithm::fail(
     afw::table::SourceRecord & measRecord,
@@ -0,0 +1,122 @@
+// -*- lsst-c++ -*-
+/*
+ * LSST Data Management System
+ * Copyright 2008-2013 LSST Corporation.
+ *
+ * This product includes software developed by the
+ * LSST Project (http://www.lsst.org/).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the LSST License Statement and
+ * the GNU General Public License along with this program.  If not,
+ * see <http://www.lsstcorp.org/LegalNotices/>.
+ */
+
+#include <cmath>
+#include <iterator>
+
+#include "ndarray/eigen.h"
+
+#include "lsst/pex/exceptions.h"
+#include "lsst/afw/geom/ellipses.h"
+#include "lsst/meas/modelfit/GaussianMatrixBuilder.h"
+
+namespace lsst { namespace meas { namespace modelfit {
+
+bool GaussianMatrixBuilder::isCompatible(
+    shapelet::MultiShapeletBasis const & basis,
+    shapelet::MultiShapeletFunction const & psf
+) {
+    for (auto i = basis.begin(); i != basis.end(); ++i) {
+        if (i->getOrder() != 0) return false;
+    }
+    for (auto const & component : psf.getComponents()) {
+        if (component.getOrder() != 0) return false;
+    }
+    return true;
+}
+
+GaussianMatrixBuilder::GaussianMatrixBuilder(
+    ndarray::Array<Pixel const,1,1> const & x,
+    ndarray::Array<Pixel const,1,1> const & y,
+    shapelet::MultiShapeletBasis const & basis,
+    shapelet::MultiShapeletFunction const & psf
+) : _basisSize(basis.getSize()),
+    _x(ndarray::asEigenArray(x).cast<double>()),
+    _y(ndarray::asEigenArray(y).cast<double>()),
+    _scratch(x.getSize<0>())
+{
+    if (!isCompatible(basis, psf)) {
+        throw LSST_EXCEPT(
+            pex::exceptions::InvalidParameterError,
+            "GaussianMatrixBuilder requires all basis and PSF components to have order 0"
+        );
+    }
+    _terms.reserve(std::distance(basis.begin(), basis.end())*psf.getComponents().size());
+    for (auto i = basis.begin(); i != basis.end(); ++i) {
+        // For order 0 the component matrix has a single row, mapping amplitudes to the
+        // sole shapelet coefficient.
+        Eigen::VectorXd row = ndarray::asEigenMatrix(i->getMatrix()).row(0);
+        for (auto const & component : psf.getComponents()) {
+            Term term;
+            term.r2 = i->getRadius()*i->getRadius();
+            afw::geom::ellipses::Quadrupole q(component.getEllipse().getCore());
+            term.pxx = q.getIxx();
+            term.pyy = q.getIyy();
+            term.pxy = q.getIxy();
+            term.px = component.getEllipse().getCenter().getX();
+            term.py = component.getEllipse().getCenter().getY();
+            // The convolution of two unit-flux Gaussians is a unit-flux Gaussian with
+            // summed covariances; with the shapelet flux convention (order-0 flux is
+            // coefficient times 2*sqrt(pi)), the convolved profile is
+            // 2 * c_basis * c_psf / sqrt(det(Sigma)) * exp(-d^T Sigma^-1 d / 2).
+            term.coefficients = 2.0*component.getCoefficients()[0]*row;
+            _terms.push_back(std::move(term));
+        }
+    }
+}
+
+void GaussianMatrixBuilder::operator()(
+    ndarray::Array<Pixel,2,-1> const & output,
+    afw::geom::ellipses::Ellipse const & ellipse
+) const {
+    afw::geom::ellipses::Quadrupole q(ellipse.getCore());
+    double const exx = q.getIxx();
+    double const eyy = q.getIyy();
+    double const exy = q.getIxy();
+    double const cx = ellipse.getCenter().getX();
+    double const cy = ellipse.getCenter().getY();
+    auto out = ndarray::asEigenArray(output);
+    for (Term const & term : _terms) {
+        double const sxx = term.r2*exx + term.pxx;
+        double const syy = term.r2*eyy + term.pyy;
+        double const sxy = term.r2*exy + term.pxy;
+        double const det = sxx*syy - sxy*sxy;
+        // Inverse covariance; the determinant is positive for any valid ellipse, but a
+        // degenerate (zero-size, delta-function PSF) component can make it zero, in which
+        // case the generic machinery would fail too, so just let the NaNs propagate.
+        double const ixx = syy/det;
+        double const iyy = sxx/det;
+        double const ixy = -sxy/det;
+        double const norm = 1.0/std::sqrt(det);
+        auto dx = _x - (cx + term.px);
+        auto dy = _y - (cy + term.py);
+        _scratch = (-0.5*(ixx*dx.square() + iyy*dy.square() + 2.0*ixy*dx*dy)).exp();
+        for (int a = 0; a < _basisSize; ++a) {
+            double const k = norm*term.coefficients[a];
+            if (k == 0.0) continue;
+            out.col(a) += (k*_scratch).cast<Pixel>();
+        }
+    }
+}
+
+}}} // namespace lsst::meas::modelfit
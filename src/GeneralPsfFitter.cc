@@ -21,6 +21,9 @@
  * see <http://www.lsstcorp.org/LegalNotices/>.
  */
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
 
 #include "ndarray/eigen.h"
 
@@ -355,9 +358,82 @@ ComponentVector vectorizeComponents(GeneralPsfFitterControl const & ctrl) {
 
 } // anonymous
 
+/*
+ *  Uniform-grid spatial index over previous fit results, used to warm-start nearby fits.
+ *
+ *  The grid cell size equals the search radius, so a query only ever has to inspect the 3x3
+ *  block of cells around the query position.  This keeps both insertion and lookup O(1) in
+ *  the number of cached fits, which matters in crowded fields where the cache can grow to
+ *  thousands of entries per CCD.
+ */
+class GeneralPsfFitter::SpatialCache {
+public:
+
+    explicit SpatialCache(double radius) : _radius(radius) {}
+
+    /// Return the nearest cached fit within the search radius, or nullptr if there is none.
+    shapelet::MultiShapeletFunction const * find(geom::Point2D const & position) const {
+        Cell center = makeCell(position);
+        shapelet::MultiShapeletFunction const * best = nullptr;
+        double bestDistSqr = _radius*_radius;
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                auto cell = _grid.find(Cell(center.first + dx, center.second + dy));
+                if (cell == _grid.end()) continue;
+                for (std::size_t n : cell->second) {
+                    double distSqr = (_entries[n].first - position).computeSquaredNorm();
+                    if (distSqr <= bestDistSqr) {
+                        bestDistSqr = distSqr;
+                        best = &_entries[n].second;
+                    }
+                }
+            }
+        }
+        return best;
+    }
+
+    void insert(geom::Point2D const & position, shapelet::MultiShapeletFunction const & fit) {
+        _grid[makeCell(position)].push_back(_entries.size());
+        _entries.push_back(std::make_pair(position, fit));
+    }
+
+    void clear() {
+        _entries.clear();
+        _grid.clear();
+    }
+
+    std::size_t size() const { return _entries.size(); }
+
+private:
+
+    typedef std::pair<int,int> Cell;
+
+    struct CellHash {
+        std::size_t operator()(Cell const & cell) const {
+            return std::hash<std::int64_t>()(
+                (static_cast<std::int64_t>(cell.first) << 32) ^ static_cast<std::int64_t>(cell.second)
+            );
+        }
+    };
+
+    Cell makeCell(geom::Point2D const & position) const {
+        return Cell(
+            static_cast<int>(std::floor(position.getX()/_radius)),
+            static_cast<int>(std::floor(position.getY()/_radius))
+        );
+    }
+
+    double _radius;
+    std::vector<std::pair<geom::Point2D,shapelet::MultiShapeletFunction>> _entries;
+    std::unordered_map<Cell,std::vector<std::size_t>,CellHash> _grid;
+};
+
 GeneralPsfFitter::GeneralPsfFitter(GeneralPsfFitterControl const & ctrl) :
     _ctrl(ctrl)
 {
+    if (_ctrl.warmStartRadius > 0.0) {
+        _cache = std::make_shared<SpatialCache>(_ctrl.warmStartRadius);
+    }
     if (_ctrl.primary.order < 0) {
         throw LSST_EXCEPT(
             pex::exceptions::InvalidParameterError,
@@ -412,6 +488,28 @@ GeneralPsfFitter::GeneralPsfFitter(GeneralPsfFitterControl const & ctrl) :
     _model = std::make_shared<GeneralPsfFitterModel>(
         basisVector, nonlinearNames, amplitudeNames, fixedNames, components
     );
+
+    if (_ctrl.doCoarsePass) {
+        bool anyHighOrder = false;
+        for (ComponentIterator i = components.begin(); i != components.end(); ++i) {
+            if (i->second.order > 0) {
+                anyHighOrder = true;
+            }
+        }
+        if (anyHighOrder) {
+            // Order-0 companion fitter for the coarse pass: same components and priors,
+            // but one amplitude per component.  Disabled components stay disabled, and
+            // the companion never recurses into a coarse pass of its own.
+            GeneralPsfFitterControl coarseCtrl(_ctrl);
+            coarseCtrl.doCoarsePass = false;
+            coarseCtrl.warmStartRadius = 0.0;
+            if (coarseCtrl.inner.order > 0) coarseCtrl.inner.order = 0;
+            if (coarseCtrl.primary.order > 0) coarseCtrl.primary.order = 0;
+            if (coarseCtrl.wings.order > 0) coarseCtrl.wings.order = 0;
+            if (coarseCtrl.outer.order > 0) coarseCtrl.outer.order = 0;
+            _coarse = std::make_shared<GeneralPsfFitter>(coarseCtrl);
+        }
+    }
 }
 
 shapelet::MultiShapeletFunctionKey GeneralPsfFitter::addFields(
@@ -457,6 +555,18 @@ shapelet::MultiShapeletFunction GeneralPsfFitter::apply(
     }
     shapelet::MultiShapeletFunction initial
         = std::static_pointer_cast<GeneralPsfFitterModel>(_model)->makeInitial(moments);
+    if (_coarse) {
+        // Coarse-to-fine: fit the order-0 companion model on a binned copy of the
+        // image first, then start the full fit from its adapted solution.  The
+        // coarse pass is only a warm start, so its optimizer state is ignored; any
+        // real failure will recur in the full fit and be reported there.
+        shapelet::MultiShapeletFunction coarseInitial =
+            std::static_pointer_cast<GeneralPsfFitterModel>(_coarse->_model)->makeInitial(moments);
+        shapelet::MultiShapeletFunction coarseFit = _coarse->_applyImpl(
+            image, coarseInitial, noiseSigma, nullptr, std::max(_ctrl.coarseBinFactor, 1)
+        );
+        initial = adapt(coarseFit, _coarse->getModel());
+    }
     return apply(image, initial, noiseSigma, pState);
 }
 
@@ -465,6 +575,16 @@ shapelet::MultiShapeletFunction GeneralPsfFitter::apply(
     shapelet::MultiShapeletFunction const & initial,
     Scalar noiseSigma,
     int * pState
+) const {
+    return _applyImpl(image, initial, noiseSigma, pState, 1);
+}
+
+shapelet::MultiShapeletFunction GeneralPsfFitter::_applyImpl(
+    afw::image::Image<Pixel> const & image,
+    shapelet::MultiShapeletFunction const & initial,
+    Scalar noiseSigma,
+    int * pState,
+    int binFactor
 ) const {
     if (noiseSigma <= 0) {
         noiseSigma = _ctrl.defaultNoiseSigma;
@@ -479,7 +599,7 @@ shapelet::MultiShapeletFunction GeneralPsfFitter::apply(
     std::static_pointer_cast<GeneralPsfFitterModel>(_model)->fillParameters(initial, nonlinear, amplitudes, fixed);
 
     std::shared_ptr<Likelihood> likelihood = std::make_shared<MultiShapeletPsfLikelihood>(
-        image.getArray(), image.getXY0(), _model, noiseSigma, fixed
+        image.getArray(), image.getXY0(), _model, noiseSigma, fixed, binFactor
     );
     std::shared_ptr<OptimizerObjective> objective = OptimizerObjective::makeFromLikelihood(likelihood, _prior);
     Optimizer optimizer(objective, parameters, _ctrl.optimizer);
@@ -492,6 +612,34 @@ shapelet::MultiShapeletFunction GeneralPsfFitter::apply(
     return _model->makeShapeletFunction(nonlinear, amplitudes, fixed);
 }
 
+shapelet::MultiShapeletFunction GeneralPsfFitter::apply(
+    afw::image::Image<Pixel> const & image,
+    afw::geom::ellipses::Quadrupole const & moments,
+    geom::Point2D const & position,
+    Scalar noiseSigma,
+    int * pState
+) const {
+    if (!_cache) {
+        return apply(image, moments, noiseSigma, pState);
+    }
+    shapelet::MultiShapeletFunction const * nearest = _cache->find(position);
+    shapelet::MultiShapeletFunction result = nearest
+        ? apply(image, *nearest, noiseSigma, pState)
+        : apply(image, moments, noiseSigma, pState);
+    _cache->insert(position, result);
+    return result;
+}
+
+std::size_t GeneralPsfFitter::getCacheSize() const {
+    return _cache ? _cache->size() : std::size_t(0);
+}
+
+void GeneralPsfFitter::clearCache() {
+    if (_cache) {
+        _cache->clear();
+    }
+}
+
 GeneralPsfFitterAlgorithm::GeneralPsfFitterAlgorithm(GeneralPsfFitterControl const & ctrl,
     afw::table::Schema & schema,
     std::string const & prefix
@@ -650,24 +798,70 @@ MultiShapeletPsfLikelihood::MultiShapeletPsfLikelihood(
     geom::Point2I const & xy0,
     std::shared_ptr<Model> model,
     Scalar sigma,
-    ndarray::Array<Scalar const,1,1> const & fixed
+    ndarray::Array<Scalar const,1,1> const & fixed,
+    int binFactor
 ) :
-    Likelihood(model, fixed)
+    Likelihood(model, fixed),
+    _image(image),
+    _xy0(xy0),
+    _sigma(sigma),
+    _binFactor(binFactor)
 {
+    if (binFactor < 1) {
+        throw LSST_EXCEPT(
+            pex::exceptions::InvalidParameterError,
+            (boost::format("binFactor (%d) must be >= 1") % binFactor).str()
+        );
+    }
     int nx = image.getSize<1>();
     int ny = image.getSize<0>();
-    int nTot = nx*ny;
-    ndarray::Array<Pixel,1,1> x = ndarray::allocate(nTot);
-    ndarray::Array<Pixel,1,1> y = ndarray::allocate(nTot);
-    int j = 0;
-    for (int iy = xy0.getY(), yEnd = xy0.getY() + ny; iy < yEnd; ++iy) {
-        for (int ix = xy0.getX(), xEnd = xy0.getX() + nx; ix < xEnd; ++ix, ++j) {
-            x[j] = ix;
-            y[j] = iy;
+    ndarray::Array<Pixel,1,1> x;
+    ndarray::Array<Pixel,1,1> y;
+    ndarray::Array<Pixel,1,1> data;
+    if (binFactor == 1) {
+        int nTot = nx*ny;
+        x = ndarray::allocate(nTot);
+        y = ndarray::allocate(nTot);
+        int j = 0;
+        for (int iy = xy0.getY(), yEnd = xy0.getY() + ny; iy < yEnd; ++iy) {
+            for (int ix = xy0.getX(), xEnd = xy0.getX() + nx; ix < xEnd; ++ix, ++j) {
+                x[j] = ix;
+                y[j] = iy;
+            }
+        }
+        data = ndarray::flatten<1>(ndarray::copy(image));
+    } else {
+        // Bin-average the image, placing each binned sample at the mean position of
+        // the pixels it covers, still in the original pixel coordinate system, so
+        // the model is evaluated in full-resolution units; partial bins at the edges
+        // are averaged over the pixels they actually contain.
+        int const bny = (ny + binFactor - 1)/binFactor;
+        int const bnx = (nx + binFactor - 1)/binFactor;
+        int const nTot = bnx*bny;
+        x = ndarray::allocate(nTot);
+        y = ndarray::allocate(nTot);
+        data = ndarray::allocate(nTot);
+        int j = 0;
+        for (int by = 0; by < bny; ++by) {
+            int const y0 = by*binFactor;
+            int const y1 = std::min(y0 + binFactor, ny);
+            for (int bx = 0; bx < bnx; ++bx, ++j) {
+                int const x0 = bx*binFactor;
+                int const x1 = std::min(x0 + binFactor, nx);
+                double sum = 0.0;
+                for (int iy = y0; iy < y1; ++iy) {
+                    for (int ix = x0; ix < x1; ++ix) {
+                        sum += image[iy][ix];
+                    }
+                }
+                data[j] = sum/((y1 - y0)*(x1 - x0));
+                x[j] = xy0.getX() + 0.5*(x0 + x1 - 1);
+                y[j] = xy0.getY() + 0.5*(y0 + y1 - 1);
+            }
         }
     }
     _impl.reset(new Impl(x, y, model->makeEllipseVector(), model->getBasisVector(), sigma));
-    _data = ndarray::flatten<1>(ndarray::copy(image));
+    _data = data;
     _data.deep() /= sigma;
     _weights = ndarray::allocate(_data.getShape());
     _weights.deep() = 1.0;
@@ -678,9 +872,16 @@ void MultiShapeletPsfLikelihood::computeModelMatrix(
     ndarray::Array<Scalar const,1,1> const & nonlinear,
     bool doApplyWeights
 ) const {
+    ++_modelMatrixCount;
     return _impl->computeModelMatrix(modelMatrix, nonlinear, _fixed, *getModel());
 }
 
+std::shared_ptr<Likelihood> MultiShapeletPsfLikelihood::clone() const {
+    return std::make_shared<MultiShapeletPsfLikelihood>(
+        _image, _xy0, getModel(), _sigma, getFixed(), _binFactor
+    );
+}
+
 MultiShapeletPsfLikelihood::~MultiShapeletPsfLikelihood() {}
 
 }}} // namespace lsst::meas::modelfit
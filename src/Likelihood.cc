@@ -0,0 +1,60 @@
+// -*- lsst-c++ -*-
+/*
+ * LSST Data Management System
+ * Copyright 2008-2013 LSST Corporation.
+ *
+ * This product includes software developed by the
+ * LSST Project (http://www.lsst.org/).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the LSST License Statement and
+ * the GNU General Public License along with this program.  If not,
+ * see <http://www.lsstcorp.org/LegalNotices/>.
+ */
+
+#include "ndarray.h"
+#include "ndarray/eigen.h"
+
+#include "lsst/meas/modelfit/Likelihood.h"
+
+namespace lsst { namespace meas { namespace modelfit {
+
+Likelihood::FitStatistics::FitStatistics(int amplitudeDim) :
+    modelSquared(Matrix::Zero(amplitudeDim, amplitudeDim)),
+    modelSquaredVariance(Matrix::Zero(amplitudeDim, amplitudeDim)),
+    modelDotData(Vector::Zero(amplitudeDim)),
+    modelSum(Vector::Zero(amplitudeDim)),
+    dataSquaredNorm(0.0)
+{}
+
+Likelihood::FitStatistics Likelihood::computeFitStatistics(
+    ndarray::Array<Scalar const,1,1> const & nonlinear
+) const {
+    FitStatistics result(getAmplitudeDim());
+    // Fallback implementation: materialize the full (unweighted) model matrix and form the
+    // products from it.  Subclasses that can stream over pixel blocks should override this.
+    ndarray::Array<Pixel,2,2> matrixT = ndarray::allocate(getAmplitudeDim(), getDataDim());
+    ndarray::Array<Pixel,2,-1> matrix = matrixT.transpose();
+    computeModelMatrix(matrix, nonlinear, false);
+    auto a = ndarray::asEigenMatrix(matrix);
+    auto y = ndarray::asEigenMatrix(getUnweightedData());
+    result.modelSquared.selfadjointView<Eigen::Lower>().rankUpdate(a.adjoint().cast<Scalar>());
+    result.modelSquared = result.modelSquared.selfadjointView<Eigen::Lower>();
+    result.modelSquaredVariance = a.adjoint().cast<Scalar>() *
+        ndarray::asEigenMatrix(getVariance()).cast<Scalar>().asDiagonal() * a.cast<Scalar>();
+    result.modelDotData = (a.adjoint() * y).cast<Scalar>();
+    result.modelSum = a.colwise().sum().cast<Scalar>().transpose();
+    result.dataSquaredNorm = y.squaredNorm();
+    return result;
+}
+
+}}} // namespace lsst::meas::modelfit
@@ -21,6 +21,16 @@
  * see <http://www.lsstcorp.org/LegalNotices/>.
  */
 
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "boost/math/special_functions/gamma.hpp"
 
 #include "ndarray/eigen.h"
@@ -48,9 +58,33 @@ template std::shared_ptr<meas::modelfit::Mixture> PersistableFacade<meas::modelf
 namespace meas {
 namespace modelfit {
 
+namespace {
+
+// Return true if all off-diagonal elements of the given matrix are exactly zero,
+// so triangular solves against its Cholesky factor reduce to element-wise scaling.
+bool isDiagonalMatrix(Matrix const & sigma) {
+    for (int j = 0; j < sigma.cols(); ++j) {
+        for (int i = 0; i < sigma.rows(); ++i) {
+            if (i != j && sigma(i, j) != 0.0) return false;
+        }
+    }
+    return true;
+}
+
+// Upper bound on the largest eigenvalue of a symmetric matrix (Gershgorin: maximum
+// absolute row sum); used to turn Euclidean distances into lower bounds on
+// Mahalanobis distances for component pruning (see setComponentPruningThreshold).
+Scalar computeSpectralBound(Matrix const & sigma) {
+    return sigma.cwiseAbs().rowwise().sum().maxCoeff();
+}
+
+} // anonymous
+
 void MixtureComponent::setSigma(Matrix const & sigma) {
     _sigmaLLT.compute(sigma);
     _sqrtDet = _sigmaLLT.matrixLLT().diagonal().prod();
+    _sigmaSpecBound = computeSpectralBound(sigma);
+    _isDiagonal = isDiagonalMatrix(sigma);
 }
 
 MixtureComponent MixtureComponent::project(int dim) const {
@@ -73,11 +107,13 @@ MixtureComponent MixtureComponent::project(int dim1, int dim2) const {
 }
 
 MixtureComponent::MixtureComponent(int dim) :
-    weight(1.0), _sqrtDet(1.0), _mu(Vector::Zero(dim)), _sigmaLLT(Matrix::Identity(dim,dim)) {}
+    weight(1.0), _sqrtDet(1.0), _sigmaSpecBound(1.0), _isDiagonal(true), _mu(Vector::Zero(dim)),
+    _sigmaLLT(Matrix::Identity(dim,dim)) {}
 
 
 MixtureComponent::MixtureComponent(Scalar weight_, Vector const & mu, Matrix const & sigma) :
-    weight(weight_), _mu(mu), _sigmaLLT(mu.size())
+    weight(weight_), _sigmaSpecBound(computeSpectralBound(sigma)), _isDiagonal(isDiagonalMatrix(sigma)),
+    _mu(mu), _sigmaLLT(mu.size())
 {
     LSST_THROW_IF_NE(
         sigma.rows(), _mu.size(),
@@ -101,6 +137,8 @@ MixtureComponent & MixtureComponent::operator=(MixtureComponent const & other) {
     );
     if (&other != this) {
         _sqrtDet = other._sqrtDet;
+        _sigmaSpecBound = other._sigmaSpecBound;
+        _isDiagonal = other._isDiagonal;
         _mu = other._mu;
         _sigmaLLT = other._sigmaLLT;
     }
@@ -174,6 +212,45 @@ void Mixture::setDegreesOfFreedom(Scalar df) {
         _norm = boost::math::tgamma_delta_ratio(0.5*_df, 0.5*_dim) * std::pow(_df*M_PI, 0.5*_dim);
         _isGaussian = false;
     }
+    _updatePruneZCut();
+}
+
+void Mixture::setComponentPruningThreshold(Scalar threshold) {
+    _pruneThreshold = threshold;
+    _updatePruneZCut();
+}
+
+void Mixture::_updatePruneZCut() {
+    if (!(_pruneThreshold > 0.0)) {
+        _pruneZCut = std::numeric_limits<Scalar>::infinity();
+    } else if (_isGaussian) {
+        // exp(-z/2) = threshold
+        _pruneZCut = -2.0*std::log(_pruneThreshold);
+    } else {
+        // (1 + z/df)^{-(df + dim)/2} = threshold; heavier tails give a larger cutoff
+        // than the Gaussian case for the same threshold.
+        _pruneZCut = _df*(std::pow(_pruneThreshold, -2.0/(_df + _dim)) - 1.0);
+    }
+}
+
+void Mixture::setDiagonalCovariance(bool diagonal) {
+    _diagonalCovariance = diagonal;
+    if (!diagonal) return;
+    for (iterator i = begin(); i != end(); ++i) {
+        if (!i->_isDiagonal) {
+            i->setSigma(Matrix(i->getSigma().diagonal().asDiagonal()));
+        }
+    }
+}
+
+void Mixture::setUpdateThreadCount(int nThreads) {
+    if (nThreads < 1) {
+        throw LSST_EXCEPT(
+            pex::exceptions::InvalidParameterError,
+            "Thread count for updateEM must be at least one"
+        );
+    }
+    _updateThreadCount = nThreads;
 }
 
 void Mixture::evaluate(
@@ -190,10 +267,130 @@ void Mixture::evaluate(
         pex::exceptions::LengthError,
         "Second dimension of x array (%d) does not dimension of mixture (%d)"
     );
-    ndarray::Array<Scalar const,2,1>::Iterator ix = x.begin(), xEnd = x.end();
-    ndarray::Array<Scalar,1,0>::Iterator ip = p.begin();
-    for (; ix != xEnd; ++ix, ++ip) {
-        *ip = evaluate(ndarray::asEigenMatrix(*ix));
+    _evaluateBlocked(x, p);
+}
+
+template <int N>
+void Mixture::_evaluateBlockedFixed(
+    ndarray::Array<Scalar const,2,1> const & x,
+    ndarray::Array<Scalar,1,0> const & p
+) const {
+    // Fixed-dimension variant of _evaluateBlocked: with the number of rows
+    // known at compile time, the triangular solve unrolls over rows and
+    // vectorizes over the sample columns, and the per-component copies of mu
+    // and the Cholesky factor live entirely on the stack.
+    static int const BLOCK_SIZE = 256;
+    int const nSamples = x.getSize<0>();
+    auto const xMatrix = ndarray::asEigenMatrix(x);
+    auto pVector = ndarray::asEigenMatrix(p);
+    Eigen::Matrix<Scalar,N,Eigen::Dynamic> d(N, BLOCK_SIZE);
+    Eigen::Array<Scalar,Eigen::Dynamic,1> z(BLOCK_SIZE);
+    Eigen::Array<Scalar,Eigen::Dynamic,1> zBound(BLOCK_SIZE);
+    bool const prune = _pruneZCut != std::numeric_limits<Scalar>::infinity();
+    for (int start = 0; start < nSamples; start += BLOCK_SIZE) {
+        int const n = std::min(BLOCK_SIZE, nSamples - start);
+        pVector.segment(start, n).setZero();
+        for (const_iterator k = begin(); k != end(); ++k) {
+            Eigen::Matrix<Scalar,N,1> const mu = k->_mu;
+            Eigen::Matrix<Scalar,N,N> const matrixL = k->_sigmaLLT.matrixLLT();
+            auto dBlock = d.leftCols(n);
+            dBlock = xMatrix.middleRows(start, n).transpose().colwise() - mu;
+            Scalar const zCutScaled = _pruneZCut * k->_sigmaSpecBound;
+            if (prune) {
+                // Squared Euclidean distances over the spectral-radius bound are lower
+                // bounds on the Mahalanobis distances, so if even the closest point's
+                // bound exceeds the cutoff the whole block can be skipped (see
+                // setComponentPruningThreshold).
+                zBound.head(n) = dBlock.colwise().squaredNorm();
+                if (zBound.head(n).minCoeff() > zCutScaled) continue;
+            }
+            if (k->_isDiagonal) {
+                // Diagonal sigma: the triangular solve reduces to scaling each
+                // row by the inverse of the corresponding Cholesky diagonal.
+                Eigen::Matrix<Scalar,N,1> const invL = matrixL.diagonal().cwiseInverse();
+                dBlock.array().colwise() *= invL.array();
+            } else {
+                matrixL.template triangularView<Eigen::Lower>().solveInPlace(dBlock);
+            }
+            z.head(n) = dBlock.colwise().squaredNorm();
+            Scalar const scaling = k->weight / (k->_sqrtDet * _norm);
+            if (_isGaussian) {
+                z.head(n) = scaling * (-0.5*z.head(n)).exp();
+            } else {
+                z.head(n) = scaling * (z.head(n)/_df + 1.0).pow(-0.5*(_df + N));
+            }
+            if (prune) {
+                // Zero the same per-point contributions the single-point overload skips,
+                // so the two paths stay consistent.
+                pVector.segment(start, n).array() +=
+                    (zBound.head(n) <= zCutScaled).select(z.head(n), 0.0);
+            } else {
+                pVector.segment(start, n).array() += z.head(n);
+            }
+        }
+    }
+}
+
+void Mixture::_evaluateBlocked(
+    ndarray::Array<Scalar const,2,1> const & x,
+    ndarray::Array<Scalar,1,0> const & p
+) const {
+    switch (_dim) {
+    case 1: return _evaluateBlockedFixed<1>(x, p);
+    case 2: return _evaluateBlockedFixed<2>(x, p);
+    case 3: return _evaluateBlockedFixed<3>(x, p);
+    }
+    // Process points in cache-sized blocks, with each component's contribution
+    // to a whole block computed as vectorized Eigen array expressions: one
+    // triangular solve against the block, one squared-norm reduction per
+    // column, and one transcendental evaluation over the block.
+    static int const BLOCK_SIZE = 256;
+    int const nSamples = x.getSize<0>();
+    auto const xMatrix = ndarray::asEigenMatrix(x);
+    auto pVector = ndarray::asEigenMatrix(p);
+    Matrix d(_dim, BLOCK_SIZE);
+    Eigen::Array<Scalar,Eigen::Dynamic,1> z(BLOCK_SIZE);
+    Eigen::Array<Scalar,Eigen::Dynamic,1> zBound(BLOCK_SIZE);
+    bool const prune = _pruneZCut != std::numeric_limits<Scalar>::infinity();
+    for (int start = 0; start < nSamples; start += BLOCK_SIZE) {
+        int const n = std::min(BLOCK_SIZE, nSamples - start);
+        pVector.segment(start, n).setZero();
+        for (const_iterator k = begin(); k != end(); ++k) {
+            auto dBlock = d.leftCols(n);
+            dBlock = xMatrix.middleRows(start, n).transpose().colwise() - k->_mu;
+            Scalar const zCutScaled = _pruneZCut * k->_sigmaSpecBound;
+            if (prune) {
+                // Squared Euclidean distances over the spectral-radius bound are lower
+                // bounds on the Mahalanobis distances, so if even the closest point's
+                // bound exceeds the cutoff the whole block can be skipped (see
+                // setComponentPruningThreshold).
+                zBound.head(n) = dBlock.colwise().squaredNorm();
+                if (zBound.head(n).minCoeff() > zCutScaled) continue;
+            }
+            if (k->_isDiagonal) {
+                // Diagonal sigma: the triangular solve reduces to scaling each
+                // row by the inverse of the corresponding Cholesky diagonal.
+                Vector const invL = k->_sigmaLLT.matrixLLT().diagonal().cwiseInverse();
+                dBlock.array().colwise() *= invL.array();
+            } else {
+                k->_sigmaLLT.matrixL().solveInPlace(dBlock);
+            }
+            z.head(n) = dBlock.colwise().squaredNorm();
+            Scalar const scaling = k->weight / (k->_sqrtDet * _norm);
+            if (_isGaussian) {
+                z.head(n) = scaling * (-0.5*z.head(n)).exp();
+            } else {
+                z.head(n) = scaling * (z.head(n)/_df + 1.0).pow(-0.5*(_df + _dim));
+            }
+            if (prune) {
+                // Zero the same per-point contributions the single-point overload skips,
+                // so the two paths stay consistent.
+                pVector.segment(start, n).array() +=
+                    (zBound.head(n) <= zCutScaled).select(z.head(n), 0.0);
+            } else {
+                pVector.segment(start, n).array() += z.head(n);
+            }
+        }
     }
 }
 
@@ -218,10 +415,12 @@ void Mixture::evaluateComponents(
     );
     ndarray::Array<Scalar const,2,1>::Iterator ix = x.begin(), xEnd = x.end();
     ndarray::Array<Scalar,2,1>::Iterator ip = p.begin();
+    Vector workspace(_dim);
     for (; ix != xEnd; ++ix, ++ip) {
         ndarray::Array<Scalar,2,1>::Reference::Iterator jp = ip->begin();
         for (const_iterator j = begin(); j != end(); ++j, ++jp) {
-            *jp = evaluate(*j, ndarray::asEigenMatrix(*ix));
+            Scalar z = _computeZ(*j, ndarray::asEigenMatrix(*ix), workspace);
+            *jp = j->weight * _evaluate(z) / j->_sqrtDet;
         }
     }
 }
@@ -293,27 +492,71 @@ void Mixture::_evaluateDerivativesImpl(
         );
         hessian->setZero();
     }
+    switch (_dim) {
+    case 1: return _evaluateDerivativesFixed<1>(x, gradient, hessian, computeHessian);
+    case 2: return _evaluateDerivativesFixed<2>(x, gradient, hessian, computeHessian);
+    case 3: return _evaluateDerivativesFixed<3>(x, gradient, hessian, computeHessian);
+    }
+    Vector workspace(_dim);
     Eigen::MatrixXd sigmaInv(_dim, _dim);
     for (ComponentList::const_iterator i = _components.begin(); i != _components.end(); ++i) {
-        _workspace = x - i->_mu;
-        i->_sigmaLLT.matrixL().solveInPlace(_workspace);
-        Scalar z = _workspace.squaredNorm();
-        i->_sigmaLLT.matrixL().adjoint().solveInPlace(_workspace);
+        workspace = x - i->_mu;
+        i->_sigmaLLT.matrixL().solveInPlace(workspace);
+        Scalar z = workspace.squaredNorm();
+        i->_sigmaLLT.matrixL().adjoint().solveInPlace(workspace);
         sigmaInv.setIdentity();
         i->_sigmaLLT.matrixL().solveInPlace(sigmaInv);
         i->_sigmaLLT.matrixL().adjoint().solveInPlace(sigmaInv);
         Scalar f = _evaluate(z) / i->_sqrtDet;
         if (_isGaussian) {
-            gradient += -i->weight * f * _workspace;
+            gradient += -i->weight * f * workspace;
             if (computeHessian) {
-                *hessian += i->weight * f * (_workspace * _workspace.adjoint() - sigmaInv);
+                *hessian += i->weight * f * (workspace * workspace.adjoint() - sigmaInv);
             }
         } else {
             double v = (_dim + _df) / (_df + z);
             double u = v*v*(1.0 + 2.0/(_dim + _df));
-            gradient += -i->weight * f * v * _workspace;
+            gradient += -i->weight * f * v * workspace;
+            if (computeHessian) {
+                *hessian += i->weight * f * (u * workspace * workspace.adjoint() - v * sigmaInv);
+            }
+        }
+    }
+}
+
+template <int N, typename A, typename B, typename C>
+void Mixture::_evaluateDerivativesFixed(
+    A const & x,
+    B & gradient,
+    C * hessian,
+    bool computeHessian
+) const {
+    // Fixed-dimension accumulation loop behind _evaluateDerivativesImpl;
+    // argument validation and zeroing have already been done by the caller.
+    Eigen::Matrix<Scalar,N,1> workspace;
+    Eigen::Matrix<Scalar,N,N> sigmaInv;
+    for (ComponentList::const_iterator i = _components.begin(); i != _components.end(); ++i) {
+        Eigen::Matrix<Scalar,N,N> const matrixL = i->_sigmaLLT.matrixLLT();
+        auto const lower = matrixL.template triangularView<Eigen::Lower>();
+        workspace = x - i->_mu;
+        lower.solveInPlace(workspace);
+        Scalar z = workspace.squaredNorm();
+        lower.adjoint().solveInPlace(workspace);
+        sigmaInv.setIdentity();
+        lower.solveInPlace(sigmaInv);
+        lower.adjoint().solveInPlace(sigmaInv);
+        Scalar f = _evaluate(z) / i->_sqrtDet;
+        if (_isGaussian) {
+            gradient += -i->weight * f * workspace;
             if (computeHessian) {
-                *hessian += i->weight * f * (u * _workspace * _workspace.adjoint() - v * sigmaInv);
+                *hessian += i->weight * f * (workspace * workspace.adjoint() - sigmaInv);
+            }
+        } else {
+            double v = (N + _df) / (_df + z);
+            double u = v*v*(1.0 + 2.0/(N + _df));
+            gradient += -i->weight * f * v * workspace;
+            if (computeHessian) {
+                *hessian += i->weight * f * (u * workspace * workspace.adjoint() - v * sigmaInv);
             }
         }
     }
@@ -329,6 +572,7 @@ void Mixture::draw(afw::math::Random & rng, ndarray::Array<Scalar,2,1> const & x
         cumulative.push_back(sum);
     }
     cumulative.back() = 1.0;
+    Vector workspace(_dim);
     for (; ix != xEnd; ++ix) {
         Scalar target = rng.uniform();
         std::size_t k = std::lower_bound(cumulative.begin(), cumulative.end(), target)
@@ -336,12 +580,19 @@ void Mixture::draw(afw::math::Random & rng, ndarray::Array<Scalar,2,1> const & x
         assert(k != cumulative.size());
         Component const & component = _components[k];
         for (int j = 0; j < _dim; ++j) {
-            _workspace[j] = rng.gaussian();
+            workspace[j] = rng.gaussian();
         }
         if (!_isGaussian) {
-            _workspace *= std::sqrt(_df/rng.chisq(_df));
+            workspace *= std::sqrt(_df/rng.chisq(_df));
+        }
+        if (component._isDiagonal) {
+            // Diagonal sigma: the Cholesky factor is diagonal, so applying it is
+            // just an element-wise product with the per-axis standard deviations.
+            ndarray::asEigenMatrix(*ix) = component._mu +
+                component._sigmaLLT.matrixLLT().diagonal().cwiseProduct(workspace);
+        } else {
+            ndarray::asEigenMatrix(*ix) = component._mu + (component._sigmaLLT.matrixL() * workspace);
         }
-        ndarray::asEigenMatrix(*ix) = component._mu + (component._sigmaLLT.matrixL() * _workspace);
     }
 }
 
@@ -365,52 +616,142 @@ void Mixture::updateEM(
     int const nComponents = _components.size();
     Matrix p(nSamples, nComponents);
     Matrix gamma(nSamples, nComponents);
-    for (int i = 0; i < nSamples; ++i) {
+    int const nThreads = std::min(_updateThreadCount, nSamples);
+    if (nThreads <= 1) {
+        _computeResponsibilities(x, w, p, gamma, 0, nSamples);
+        for (int k = 0; k < nComponents; ++k) {
+            _updateComponentEM(k, x, p, gamma, restriction, tau1, tau2);
+        }
+    } else {
+        // Rows of p (and gamma) have no cross-row dependencies, and each component
+        // update touches only its own component, so both phases are deterministic
+        // regardless of how the work is split across threads.
+        std::vector<std::thread> threads;
+        threads.reserve(nThreads);
+        int const blockSize = (nSamples + nThreads - 1) / nThreads;
+        for (int t = 0; t < nThreads; ++t) {
+            int const rowBegin = t * blockSize;
+            int const rowEnd = std::min(rowBegin + blockSize, nSamples);
+            threads.emplace_back(
+                [this, &x, &w, &p, &gamma, rowBegin, rowEnd] {
+                    _computeResponsibilities(x, w, p, gamma, rowBegin, rowEnd);
+                }
+            );
+        }
+        for (auto & thread : threads) { thread.join(); }
+        threads.clear();
+        std::atomic<int> nextComponent(0);
+        for (int t = 0; t < std::min(nThreads, nComponents); ++t) {
+            threads.emplace_back(
+                [this, &x, &p, &gamma, &restriction, &nextComponent, nComponents, tau1, tau2] {
+                    for (int k = nextComponent++; k < nComponents; k = nextComponent++) {
+                        _updateComponentEM(k, x, p, gamma, restriction, tau1, tau2);
+                    }
+                }
+            );
+        }
+        for (auto & thread : threads) { thread.join(); }
+    }
+}
+
+template <int N>
+void Mixture::_computeResponsibilitiesFixed(
+    ndarray::Array<Scalar const,2,1> const & x,
+    ndarray::Array<Scalar const,1,0> const & w,
+    Matrix & p, Matrix & gamma,
+    int rowBegin, int rowEnd
+) const {
+    int const nComponents = _components.size();
+    // Copy the component parameters into fixed-size storage once, outside the
+    // sample loop, so the per-row triangular solves fully unroll.
+    std::vector<Eigen::Matrix<Scalar,N,1>, Eigen::aligned_allocator<Eigen::Matrix<Scalar,N,1>>> mus;
+    std::vector<Eigen::Matrix<Scalar,N,N>, Eigen::aligned_allocator<Eigen::Matrix<Scalar,N,N>>> matrixLs;
+    mus.reserve(nComponents);
+    matrixLs.reserve(nComponents);
+    for (int k = 0; k < nComponents; ++k) {
+        mus.emplace_back(_components[k]._mu);
+        matrixLs.emplace_back(_components[k]._sigmaLLT.matrixLLT());
+    }
+    Eigen::Matrix<Scalar,N,1> workspace;  // local, not _workspace: this must be reentrant
+    for (int i = rowBegin; i < rowEnd; ++i) {
         Scalar pSum = 0.0;
         for (int k = 0; k < nComponents; ++k) {
-            double z = _computeZ(_components[k], ndarray::asEigenMatrix(x[i]));
+            workspace = ndarray::asEigenMatrix(x[i]) - mus[k];
+            matrixLs[k].template triangularView<Eigen::Lower>().solveInPlace(workspace);
+            double z = workspace.squaredNorm();
             pSum += p(i, k) = _components[k].weight*_evaluate(z)/_components[k]._sqrtDet;
             if (!_isGaussian) {
-                gamma(i, k) = (_df + _dim) / (_df + z);
+                gamma(i, k) = (_df + N) / (_df + z);
             }
         }
         p.row(i) *= w[i] / pSum;
     }
-    if (_isGaussian) {
+}
+
+void Mixture::_computeResponsibilities(
+    ndarray::Array<Scalar const,2,1> const & x,
+    ndarray::Array<Scalar const,1,0> const & w,
+    Matrix & p, Matrix & gamma,
+    int rowBegin, int rowEnd
+) const {
+    switch (_dim) {
+    case 1: return _computeResponsibilitiesFixed<1>(x, w, p, gamma, rowBegin, rowEnd);
+    case 2: return _computeResponsibilitiesFixed<2>(x, w, p, gamma, rowBegin, rowEnd);
+    case 3: return _computeResponsibilitiesFixed<3>(x, w, p, gamma, rowBegin, rowEnd);
+    }
+    int const nComponents = _components.size();
+    Vector workspace(_dim);  // local, not _workspace: this must be reentrant
+    for (int i = rowBegin; i < rowEnd; ++i) {
+        Scalar pSum = 0.0;
         for (int k = 0; k < nComponents; ++k) {
-            double weight = _components[k].weight = p.col(k).sum();
-            Vector & mu = _components[k]._mu;
-            Matrix sigma = Matrix::Zero(_dim, _dim);
-            mu = (p.col(k).adjoint() * ndarray::asEigenMatrix(x)) / weight;
-            restriction.restrictMu(mu);
-            Vector dx = Vector::Zero(_dim);
-            for (int i = 0; i < nSamples; ++i) {
-                dx = ndarray::asEigenMatrix(x[i]) - mu;
-                sigma.selfadjointView<Eigen::Lower>().rankUpdate(dx, p(i, k));
+            workspace = ndarray::asEigenMatrix(x[i]) - _components[k]._mu;
+            _components[k]._sigmaLLT.matrixL().solveInPlace(workspace);
+            double z = workspace.squaredNorm();
+            pSum += p(i, k) = _components[k].weight*_evaluate(z)/_components[k]._sqrtDet;
+            if (!_isGaussian) {
+                gamma(i, k) = (_df + _dim) / (_df + z);
             }
-            sigma /= weight;
-            restriction.restrictSigma(sigma);
-            updateDampedSigma(k, sigma, tau1, tau2);
+        }
+        p.row(i) *= w[i] / pSum;
+    }
+}
+
+void Mixture::_updateComponentEM(
+    int k,
+    ndarray::Array<Scalar const,2,1> const & x,
+    Matrix const & p, Matrix const & gamma,
+    UpdateRestriction const & restriction,
+    Scalar tau1, Scalar tau2
+) {
+    int const nSamples = p.rows();
+    double weight = _components[k].weight = p.col(k).sum();
+    Vector & mu = _components[k]._mu;
+    Matrix sigma = Matrix::Zero(_dim, _dim);
+    if (_isGaussian) {
+        mu = (p.col(k).adjoint() * ndarray::asEigenMatrix(x)) / weight;
+        restriction.restrictMu(mu);
+        Vector dx = Vector::Zero(_dim);
+        for (int i = 0; i < nSamples; ++i) {
+            dx = ndarray::asEigenMatrix(x[i]) - mu;
+            sigma.selfadjointView<Eigen::Lower>().rankUpdate(dx, p(i, k));
         }
     } else {
-        for (int k = 0; k < nComponents; ++k) {
-            double weight = _components[k].weight = p.col(k).sum();
-            Vector & mu = _components[k]._mu;
-            Matrix sigma = Matrix::Zero(_dim, _dim);
-            mu =
-                ((p.col(k).array() * gamma.col(k).array()).matrix().adjoint() * ndarray::asEigenMatrix(x))
-                / p.col(k).dot(gamma.col(k));
-            restriction.restrictMu(mu);
-            Vector dx = Vector::Zero(_dim);
-            for (int i = 0; i < nSamples; ++i) {
-                dx = ndarray::asEigenMatrix(x[i]) - mu;
-                sigma.selfadjointView<Eigen::Lower>().rankUpdate(dx, gamma(i, k) * p(i, k));
-            }
-            sigma /= weight;
-            restriction.restrictSigma(sigma);
-            updateDampedSigma(k, sigma, tau1, tau2);
+        mu =
+            ((p.col(k).array() * gamma.col(k).array()).matrix().adjoint() * ndarray::asEigenMatrix(x))
+            / p.col(k).dot(gamma.col(k));
+        restriction.restrictMu(mu);
+        Vector dx = Vector::Zero(_dim);
+        for (int i = 0; i < nSamples; ++i) {
+            dx = ndarray::asEigenMatrix(x[i]) - mu;
+            sigma.selfadjointView<Eigen::Lower>().rankUpdate(dx, gamma(i, k) * p(i, k));
         }
     }
+    sigma /= weight;
+    restriction.restrictSigma(sigma);
+    if (_diagonalCovariance) {
+        sigma = Matrix(sigma.diagonal().asDiagonal());
+    }
+    updateDampedSigma(k, sigma, tau1, tau2);
 }
 
 void Mixture::updateEM(
@@ -436,7 +777,7 @@ std::shared_ptr<Mixture> Mixture::clone() const {
 }
 
 Mixture::Mixture(int dim, ComponentList & components, Scalar df) :
-    _dim(dim), _df(0.0), _workspace(dim)
+    _diagonalCovariance(false), _dim(dim), _updateThreadCount(1), _df(0.0), _pruneThreshold(0.0)
 {
     setDegreesOfFreedom(df);
     _components.swap(components);
@@ -455,6 +796,8 @@ void Mixture::updateDampedSigma(int k, Matrix const & sigma, double tau1, double
     } else {
         _components[k]._sigmaLLT = sigmaLLT;
         _components[k]._sqrtDet = sqrtDet;
+        _components[k]._sigmaSpecBound = computeSpectralBound(sigma);
+        _components[k]._isDiagonal = isDiagonalMatrix(sigma);
     }
 }
 
@@ -476,6 +819,133 @@ void Mixture::_stream(std::ostream & os) const {
 
 namespace {
 
+// Header for the compact binary format written by Mixture::writeCompact.
+// The arrays that follow are, in order: weights (nComponents), mus
+// (nComponents*dim), sigmas (nComponents*dim*dim), all as native doubles.
+struct CompactMixtureHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t dim;
+    std::uint32_t nComponents;
+    std::uint32_t unused;  // reserved; keeps the doubles below 8-byte aligned
+    double df;
+};
+
+char const COMPACT_MIXTURE_MAGIC[8] = {'M', 'I', 'X', 'T', 'U', 'R', 'E', '0'};
+std::uint32_t const COMPACT_MIXTURE_VERSION = 1;
+
+} // anonymous
+
+void Mixture::writeCompact(std::string const & filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw LSST_EXCEPT(
+            pex::exceptions::IoError,
+            "Could not open '" + filename + "' for writing"
+        );
+    }
+    CompactMixtureHeader header;
+    std::copy(COMPACT_MIXTURE_MAGIC, COMPACT_MIXTURE_MAGIC + 8, header.magic);
+    header.version = COMPACT_MIXTURE_VERSION;
+    header.dim = _dim;
+    header.nComponents = _components.size();
+    header.unused = 0;
+    header.df = _df;
+    file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+    for (const_iterator i = begin(); i != end(); ++i) {
+        file.write(reinterpret_cast<char const *>(&i->weight), sizeof(Scalar));
+    }
+    for (const_iterator i = begin(); i != end(); ++i) {
+        file.write(reinterpret_cast<char const *>(i->_mu.data()), sizeof(Scalar)*_dim);
+    }
+    for (const_iterator i = begin(); i != end(); ++i) {
+        Matrix sigma = i->getSigma();
+        file.write(reinterpret_cast<char const *>(sigma.data()), sizeof(Scalar)*_dim*_dim);
+    }
+    if (!file) {
+        throw LSST_EXCEPT(
+            pex::exceptions::IoError,
+            "Error writing compact mixture to '" + filename + "'"
+        );
+    }
+}
+
+std::shared_ptr<Mixture> Mixture::readCompact(std::string const & filename) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw LSST_EXCEPT(
+            pex::exceptions::IoError,
+            "Could not open '" + filename + "' for reading"
+        );
+    }
+    struct ::stat status;
+    if (::fstat(fd, &status) != 0) {
+        ::close(fd);
+        throw LSST_EXCEPT(
+            pex::exceptions::IoError,
+            "Could not stat '" + filename + "'"
+        );
+    }
+    std::size_t const fileSize = status.st_size;
+    void * mapped = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // the mapping keeps its own reference to the file
+    if (mapped == MAP_FAILED) {
+        throw LSST_EXCEPT(
+            pex::exceptions::IoError,
+            "Could not memory-map '" + filename + "'"
+        );
+    }
+    try {
+        if (fileSize < sizeof(CompactMixtureHeader)) {
+            throw LSST_EXCEPT(
+                pex::exceptions::IoError,
+                "'" + filename + "' is too small to be a compact mixture file"
+            );
+        }
+        CompactMixtureHeader const & header = *reinterpret_cast<CompactMixtureHeader const *>(mapped);
+        if (!std::equal(COMPACT_MIXTURE_MAGIC, COMPACT_MIXTURE_MAGIC + 8, header.magic)
+            || header.version != COMPACT_MIXTURE_VERSION) {
+            throw LSST_EXCEPT(
+                pex::exceptions::IoError,
+                "'" + filename + "' is not a compact mixture file"
+            );
+        }
+        int const dim = header.dim;
+        std::size_t const nComponents = header.nComponents;
+        if (fileSize < sizeof(CompactMixtureHeader)
+            + sizeof(Scalar)*nComponents*(1 + dim + dim*dim)) {
+            throw LSST_EXCEPT(
+                pex::exceptions::IoError,
+                "'" + filename + "' is truncated"
+            );
+        }
+        Scalar const * weights = reinterpret_cast<Scalar const *>(
+            static_cast<char const *>(mapped) + sizeof(CompactMixtureHeader)
+        );
+        Scalar const * mus = weights + nComponents;
+        Scalar const * sigmas = mus + nComponents*dim;
+        ComponentList components;
+        components.reserve(nComponents);
+        for (std::size_t k = 0; k < nComponents; ++k) {
+            components.push_back(
+                MixtureComponent(
+                    weights[k],
+                    Eigen::Map<Vector const>(mus + k*dim, dim),
+                    Eigen::Map<Matrix const>(sigmas + k*dim*dim, dim, dim)
+                )
+            );
+        }
+        std::shared_ptr<Mixture> result = std::make_shared<Mixture>(dim, components, header.df);
+        ::munmap(mapped, fileSize);
+        return result;
+    } catch (...) {
+        ::munmap(mapped, fileSize);
+        throw;
+    }
+}
+
+namespace {
+
 class MixturePersistenceKeys {
 public:
     tbl::Schema schema;
@@ -334,6 +334,29 @@ Model::EllipseVector Model::writeEllipses(
     return r;
 }
 
+void Model::writeEllipses(
+    ndarray::Array<Scalar const,1,1> const & nonlinear,
+    ndarray::Array<Scalar const,1,1> const & fixed,
+    EllipseVector & ellipses
+) const {
+    LSST_THROW_IF_NE(
+        nonlinear.getSize<0>(), getNonlinearDim(),
+        pex::exceptions::LengthError,
+        "Size of nonlinear array (%d) does not match dimension of model (%d)"
+    );
+    LSST_THROW_IF_NE(
+        fixed.getSize<0>(), getFixedDim(),
+        pex::exceptions::LengthError,
+        "Size of fixed array (%d) does not match dimension of model (%d)"
+    );
+    LSST_THROW_IF_NE(
+        int(ellipses.size()), getBasisCount(),
+        pex::exceptions::LengthError,
+        "Size of ellipse vector (%d) does not match basis count (%d)"
+    );
+    writeEllipses(nonlinear.begin(), fixed.begin(), ellipses.begin());
+}
+
 void Model::readEllipses(
     EllipseVector const & ellipses,
     ndarray::Array<Scalar,1,1> const & nonlinear,
@@ -78,6 +78,7 @@ std::shared_ptr<Prior> MultiModel::adaptPrior(std::shared_ptr<Prior> prior) cons
 
 Model::EllipseVector MultiModel::makeEllipseVector() const {
     EllipseVector r;
+    r.reserve(getBasisVector().size());
     for (ModelVector::const_iterator i = _components.begin(); i != _components.end(); ++i) {
         EllipseVector c = (**i).makeEllipseVector();
         r.insert(r.end(), c.begin(), c.end());
@@ -109,4 +110,30 @@ void MultiModel::readEllipses(
     }
 }
 
+void MultiModel::transformParameters(
+    LocalUnitTransform const & transform,
+    ndarray::Array<Scalar,1,1> const & nonlinear,
+    ndarray::Array<Scalar,1,1> const & amplitudes,
+    ndarray::Array<Scalar,1,1> const & fixed
+) const {
+    // ndarray views share data with the concatenated arrays, so each component
+    // transforms its own parameter segment in place; this also routes through any
+    // transformParameters overrides the components may have, which the default
+    // implementation (convert-to-ellipses-and-back on the whole model) cannot.
+    int nonlinearOffset = 0;
+    int amplitudeOffset = 0;
+    int fixedOffset = 0;
+    for (ModelVector::const_iterator i = _components.begin(); i != _components.end(); ++i) {
+        (**i).transformParameters(
+            transform,
+            nonlinear[ndarray::view(nonlinearOffset, nonlinearOffset + (**i).getNonlinearDim())],
+            amplitudes[ndarray::view(amplitudeOffset, amplitudeOffset + (**i).getAmplitudeDim())],
+            fixed[ndarray::view(fixedOffset, fixedOffset + (**i).getFixedDim())]
+        );
+        nonlinearOffset += (**i).getNonlinearDim();
+        amplitudeOffset += (**i).getAmplitudeDim();
+        fixedOffset += (**i).getFixedDim();
+    }
+}
+
 }}} // namespace lsst::meas::modelfit
@@ -22,6 +22,9 @@
  * see <http://www.lsstcorp.org/LegalNotices/>.
  */
 #include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
 
 #include "lsst/meas/modelfit/PixelFitRegion.h"
 #include "lsst/afw/geom/SpanSet.h"
@@ -39,6 +42,21 @@ afw::image::MaskPixel initBadPixelMask(std::vector<std::string> const & planes)
     return badPixelMask;
 }
 
+// Process-wide cache of origin-centered circular span templates, keyed by
+// integer pixel radius.  Rasterizing a circle once per radius and shifting the
+// template is much cheaper than rasterizing an ellipse per source, and the
+// cache is bounded by the number of distinct radius bins actually used.
+std::shared_ptr<afw::geom::SpanSet> getCircularSpanTemplate(int radius) {
+    static std::mutex mutex;
+    static std::map<int, std::shared_ptr<afw::geom::SpanSet>> cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<afw::geom::SpanSet> & entry = cache[radius];
+    if (!entry) {
+        entry = afw::geom::SpanSet::fromShape(radius, afw::geom::Stencil::CIRCLE);
+    }
+    return entry;
+}
+
 } // anonymous
 
 
@@ -160,8 +178,25 @@ bool PixelFitRegion::applyEllipse(
 
 void PixelFitRegion::applyMask(afw::image::Mask<> const & mask, geom::Point2D const & center) {
     Scalar originalArea = ellipse.getArea();
+    std::shared_ptr<afw::geom::SpanSet> regionSpans;
+    if (_ctrl.circularSpanTemplateTolerance > 0.0) {
+        // Fast path for nearly-circular (i.e. PSF-sized) regions: shift a
+        // shared circular template instead of rasterizing the ellipse.  The
+        // template radius is rounded up by the half-pixel center shift, so the
+        // approximate region always contains the exact one.
+        afw::geom::ellipses::Axes axes(ellipse);
+        if (axes.getA() - axes.getB() < _ctrl.circularSpanTemplateTolerance) {
+            int const radius = static_cast<int>(std::ceil(axes.getA() + 0.5));
+            regionSpans = getCircularSpanTemplate(radius)->shiftedBy(
+                std::lround(center.getX()), std::lround(center.getY())
+            );
+        }
+    }
+    if (!regionSpans) {
+        regionSpans = afw::geom::SpanSet::fromShape(afw::geom::ellipses::Ellipse(ellipse, center));
+    }
     footprint = std::make_shared<afw::detection::Footprint>(
-        afw::geom::SpanSet::fromShape(afw::geom::ellipses::Ellipse(ellipse, center)),
+        regionSpans,
         mask.getBBox(lsst::afw::image::PARENT)
     );
     footprint->clipTo(mask.getBBox(afw::image::PARENT));
@@ -0,0 +1,131 @@
+// -*- lsst-c++ -*-
+/*
+ * LSST Data Management System
+ * Copyright 2008-2013 LSST Corporation.
+ *
+ * This product includes software developed by the
+ * LSST Project (http://www.lsst.org/).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the LSST License Statement and
+ * the GNU General Public License along with this program.  If not,
+ * see <http://www.lsstcorp.org/LegalNotices/>.
+ */
+
+#include <vector>
+
+#include "boost/format.hpp"
+
+#include "lsst/pex/exceptions.h"
+#include "lsst/afw/table/BaseRecord.h"
+#include "lsst/meas/modelfit/SampleSetFile.h"
+
+namespace lsst { namespace meas { namespace modelfit {
+
+namespace {
+
+char const MAGIC[8] = {'M', 'F', 'S', 'A', 'M', 'P', 'L', 'E'};
+std::int64_t const VERSION = 1;
+
+void writeInt64(std::ofstream & stream, std::int64_t value) {
+    stream.write(reinterpret_cast<char const *>(&value), sizeof(value));
+}
+
+void writeColumn(std::ofstream & stream, std::vector<double> const & column) {
+    stream.write(
+        reinterpret_cast<char const *>(column.data()),
+        column.size()*sizeof(double)
+    );
+}
+
+} // anonymous
+
+SampleSetWriter::SampleSetWriter(std::string const & filename, int parameterDim) :
+    _parameterDim(parameterDim),
+    _blockCount(0),
+    _stream(filename, std::ios::binary | std::ios::trunc)
+{
+    if (!_stream) {
+        throw LSST_EXCEPT(
+            pex::exceptions::IoError,
+            (boost::format("Could not open sample set file '%s' for writing") % filename).str()
+        );
+    }
+    _stream.write(MAGIC, sizeof(MAGIC));
+    writeInt64(_stream, VERSION);
+    writeInt64(_stream, _parameterDim);
+    _stream.flush();
+}
+
+void SampleSetWriter::append(afw::table::BaseCatalog const & samples, std::int64_t id) {
+    if (!_stream.is_open()) {
+        throw LSST_EXCEPT(
+            pex::exceptions::LogicError,
+            "Cannot append to a closed SampleSetWriter"
+        );
+    }
+    afw::table::Schema schema = samples.getSchema();
+    afw::table::Key<Scalar> weightKey = schema["weight"];
+    afw::table::Key<Scalar> objectiveKey = schema["objective"];
+    afw::table::Key<Scalar> proposalKey = schema["proposal"];
+    afw::table::Key< afw::table::Array<Scalar> > parametersKey = schema["parameters"];
+    if (parametersKey.getSize() != std::size_t(_parameterDim)) {
+        throw LSST_EXCEPT(
+            pex::exceptions::LengthError,
+            (boost::format("Catalog parameter dimension (%d) does not match file header (%d)")
+             % parametersKey.getSize() % _parameterDim).str()
+        );
+    }
+    std::size_t const n = samples.size();
+    // Gather the record fields into contiguous columns before writing; the
+    // buffers are tiny compared to the catalog itself.
+    std::vector<double> weight(n);
+    std::vector<double> objective(n);
+    std::vector<double> proposal(n);
+    std::vector<double> parameters(n*_parameterDim);
+    for (std::size_t k = 0; k < n; ++k) {
+        afw::table::BaseRecord const & record = samples[k];
+        weight[k] = record.get(weightKey);
+        objective[k] = record.get(objectiveKey);
+        proposal[k] = record.get(proposalKey);
+        ndarray::Array<Scalar const,1,1> p = record.get(parametersKey);
+        std::copy(p.begin(), p.end(), parameters.begin() + k*_parameterDim);
+    }
+    writeInt64(_stream, (id < 0) ? _blockCount : id);
+    writeInt64(_stream, n);
+    writeColumn(_stream, weight);
+    writeColumn(_stream, objective);
+    writeColumn(_stream, proposal);
+    writeColumn(_stream, parameters);
+    // Flush after each block so a crashed run leaves a file that is valid up
+    // to its last complete block.
+    _stream.flush();
+    if (!_stream) {
+        throw LSST_EXCEPT(
+            pex::exceptions::IoError,
+            "Error writing to sample set file"
+        );
+    }
+    ++_blockCount;
+}
+
+void SampleSetWriter::close() {
+    if (_stream.is_open()) {
+        _stream.close();
+    }
+}
+
+SampleSetWriter::~SampleSetWriter() {
+    close();
+}
+
+}}} // namespace lsst::meas::modelfit
@@ -144,6 +144,30 @@ Scalar SoftenedLinearPrior::evaluate(
     }
 }
 
+void SoftenedLinearPrior::evaluate(
+    ndarray::Array<Scalar const,2,1> const & nonlinear,
+    ndarray::Array<Scalar const,2,1> const & amplitudes,
+    ndarray::Array<Scalar,1,1> const & out
+) const {
+    LSST_THROW_IF_NE(
+        nonlinear.getSize<0>(), amplitudes.getSize<0>(),
+        pex::exceptions::LengthError,
+        "Number of nonlinear parameter rows (%d) does not match number of amplitude rows (%d)"
+    );
+    LSST_THROW_IF_NE(
+        nonlinear.getSize<0>(), out.getSize<0>(),
+        pex::exceptions::LengthError,
+        "Number of nonlinear parameter rows (%d) does not match number of output values (%d)"
+    );
+    for (std::size_t k = 0; k < out.getSize<0>(); ++k) {
+        if ((ndarray::asEigenArray(amplitudes[k]) < 0.0).any()) {
+            out[k] = 0.0;
+        } else {
+            out[k] = _evaluate(nonlinear[k]);
+        }
+    }
+}
+
 void SoftenedLinearPrior::evaluateDerivatives(
     ndarray::Array<Scalar const,1,1> const & nonlinear,
     ndarray::Array<Scalar const,1,1> const & amplitudes,
@@ -49,6 +49,23 @@ namespace {
 static double const THRESHOLD = 1E-15;
 static double const SLN_THRESHOLD = 1E-5;
 
+// Compute the eigen-decomposition H = V S V^T used by the series-form factory,
+// including the sign convention the singular-case logic relies on.
+void decomposeHessian(Matrix const & hessian, Vector & s, Matrix & v) {
+    if (hessian.rows() == 1) {
+        s[0] = hessian(0,0);
+        v.setIdentity();
+    } else {
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix2d> eig(hessian.block<2,2>(0,0));
+        s.head<2>() = eig.eigenvalues();
+        v.block<2,2>(0,0) = eig.eigenvectors();
+        if (v(0,1) < 0.0) { // just enforces a convention
+            v(0,1) *= -1;
+            v(1,1) *= -1;
+        }
+    }
+}
+
 } // anonymous
 
 // -------- Main TruncatedGaussian class --------------------------------------------------------------------
@@ -72,9 +89,6 @@ public:
 TruncatedGaussian TruncatedGaussian::fromSeriesParameters(
     Scalar q0, Vector const & gradient, Matrix const & hessian
 ) {
-    static Scalar const LN_2PI = std::log(2.0*M_PI);
-    static Scalar const SQRT_PI = std::sqrt(M_PI);
-    LOG_LOGGER trace4Logger = LOG_GET("TRACE4.meas.modelfit.TruncatedGaussian");
     int const n = gradient.size();
     if (hessian.rows() != n || hessian.cols() != n) {
         throw LSST_EXCEPT(
@@ -83,6 +97,26 @@ TruncatedGaussian TruncatedGaussian::fromSeriesParameters(
              % n % hessian.rows() % hessian.cols()).str()
         );
     }
+    if (n > 2) {
+        throw LSST_EXCEPT(
+            pex::exceptions::LogicError,
+            "Greater than 2 dimensions not yet supported"
+        );
+    }
+    Vector s(n);
+    Matrix v(n, n);
+    decomposeHessian(hessian, s, v);
+    return _fromSeriesParameters(q0, gradient, hessian, s, v);
+}
+
+TruncatedGaussian TruncatedGaussian::_fromSeriesParameters(
+    Scalar q0, Vector const & gradient, Matrix const & hessian,
+    Vector const & sIn, Matrix const & vIn
+) {
+    static Scalar const LN_2PI = std::log(2.0*M_PI);
+    static Scalar const SQRT_PI = std::sqrt(M_PI);
+    LOG_LOGGER trace4Logger = LOG_GET("TRACE4.meas.modelfit.TruncatedGaussian");
+    int const n = gradient.size();
     std::shared_ptr<Impl> impl = std::make_shared<Impl>(n);
     if (n == 1) {
         Scalar g = gradient[0];
@@ -102,13 +136,8 @@ TruncatedGaussian TruncatedGaussian::fromSeriesParameters(
         // it's too tricky to figure out the Eigen return types.
         Eigen::Vector2d g = gradient.segment<2>(0);
         Eigen::Matrix2d H = hessian.block<2,2>(0,0);
-        Eigen::SelfAdjointEigenSolver<Eigen::Matrix2d> eig(H);
-        Eigen::Vector2d s = eig.eigenvalues();
-        Eigen::Matrix2d v = eig.eigenvectors();
-        if (v(0,1) < 0.0) { // just enforces a convention
-            v(0,1) *= -1;
-            v(1,1) *= -1;
-        }
+        Eigen::Vector2d s = sIn.head<2>();
+        Eigen::Matrix2d v = vIn.block<2,2>(0,0);
         LOGL_DEBUG(trace4Logger,
             "fromSeriesParameters: 2d with H=[[%16.16g, %16.16g], [%16.16g, %16.16g]], g=[%16.16g, %16.16g]",
             H(0,0), H(0,1), H(1,0), H(1,1), g[0], g[1]
@@ -302,6 +331,39 @@ Scalar TruncatedGaussian::getLogIntegral() const {
 
 TruncatedGaussian::~TruncatedGaussian() {}
 
+// -------- Builder class -----------------------------------------------------------------------------------
+
+TruncatedGaussianBuilder::TruncatedGaussianBuilder(int dim) :
+    _valid(false), _hessian(Matrix::Zero(dim, dim)), _s(dim), _v(dim, dim)
+{
+    if (dim > 2) {
+        throw LSST_EXCEPT(
+            pex::exceptions::LogicError,
+            "Greater than 2 dimensions not yet supported"
+        );
+    }
+}
+
+TruncatedGaussian TruncatedGaussianBuilder::operator()(
+    Scalar q0, Vector const & gradient, Matrix const & hessian
+) {
+    int const n = _hessian.rows();
+    if (gradient.size() != n || hessian.rows() != n || hessian.cols() != n) {
+        throw LSST_EXCEPT(
+            pex::exceptions::LengthError,
+            (boost::format("Mismatch between builder dimension (%d) and grad size (%d), "
+                           "hessian dimensions (%d, %d)")
+             % n % gradient.size() % hessian.rows() % hessian.cols()).str()
+        );
+    }
+    if (!_valid || (hessian.array() != _hessian.array()).any()) {
+        decomposeHessian(hessian, _s, _v);
+        _hessian = hessian;
+        _valid = true;
+    }
+    return TruncatedGaussian::_fromSeriesParameters(q0, gradient, hessian, _s, _v);
+}
+
 // -------- LogEvaluator class ------------------------------------------------------------------------------
 
 TruncatedGaussianLogEvaluator::TruncatedGaussianLogEvaluator(TruncatedGaussian const & parent) :
@@ -354,6 +416,25 @@ public:
 
     virtual Scalar apply(afw::math::Random & rng, ndarray::Array<Scalar,1,1> const & alpha) = 0;
 
+    // Draw a whole block of samples at once; subclasses override this when they can batch the
+    // variate generation and transforms, falling back to the one-row-at-a-time loop here.
+    virtual void applyBatch(
+        afw::math::Random & rng,
+        ndarray::Array<Scalar,2,1> const & alpha,
+        ndarray::Array<Scalar,1,1> const & weights,
+        bool multiplyWeights
+    ) {
+        if (multiplyWeights) {
+            for (int i = 0, n = alpha.getSize<0>(); i < n; ++i) {
+                weights[i] *= apply(rng, alpha[i]);
+            }
+        } else {
+            for (int i = 0, n = alpha.getSize<0>(); i < n; ++i) {
+                weights[i] = apply(rng, alpha[i]);
+            }
+        }
+    }
+
     virtual ~Impl() {}
 };
 
@@ -373,6 +454,30 @@ public:
         return 1.0;
     }
 
+    virtual void applyBatch(
+        afw::math::Random & rng,
+        ndarray::Array<Scalar,2,1> const & alpha,
+        ndarray::Array<Scalar,1,1> const & weights,
+        bool multiplyWeights
+    ) {
+        int const n = alpha.getSize<0>();
+        Eigen::ArrayXd z(n);
+        for (int i = 0; i < n; ++i) {
+            z[i] = rng.gaussian();
+        }
+        Eigen::ArrayXd samples = _rootSigma*z + _mu;
+        // redraw only the samples that landed in the infeasible region
+        for (int i = 0; i < n; ++i) {
+            while (samples[i] < 0.0) {
+                samples[i] = _rootSigma*rng.gaussian() + _mu;
+            }
+            alpha[i][0] = samples[i];
+        }
+        if (!multiplyWeights) {
+            weights.deep() = 1.0;
+        }
+    }
+
 private:
     Scalar _mu;
     Scalar _rootSigma;
@@ -396,6 +501,39 @@ public:
         return 1.0;
     }
 
+    virtual void applyBatch(
+        afw::math::Random & rng,
+        ndarray::Array<Scalar,2,1> const & alpha,
+        ndarray::Array<Scalar,1,1> const & weights,
+        bool multiplyWeights
+    ) {
+        int const n = alpha.getSize<0>();
+        int const dim = _mu.size();
+        // Draw all the normal deviates for the block up front, then transform the whole block
+        // with a single matrix-matrix product instead of one matrix-vector product per sample.
+        Eigen::MatrixXd z(dim, n);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < dim; ++j) {
+                z(j, i) = rng.gaussian();
+            }
+        }
+        Eigen::MatrixXd samples = _rootSigma * z;
+        samples.colwise() += _mu;
+        // redraw only the samples that landed in the infeasible region
+        for (int i = 0; i < n; ++i) {
+            while ((samples.col(i).array() < 0.0).any()) {
+                for (int j = 0; j < dim; ++j) {
+                    _workspace[j] = rng.gaussian();
+                }
+                samples.col(i) = _rootSigma * _workspace + _mu;
+            }
+        }
+        ndarray::asEigenMatrix(alpha) = samples.adjoint();
+        if (!multiplyWeights) {
+            weights.deep() = 1.0;
+        }
+    }
+
 private:
     Vector _mu;
     Vector _workspace;
@@ -479,6 +617,38 @@ public:
         return std::exp(logProposal - logActual);
     }
 
+    virtual void applyBatch(
+        afw::math::Random & rng,
+        ndarray::Array<Scalar,2,1> const & alpha,
+        ndarray::Array<Scalar,1,1> const & weights,
+        bool multiplyWeights
+    ) {
+        int const n = alpha.getSize<0>();
+        int const dim = _mu.size();
+        // Draw all the truncated normal deviates for the block up front (unscaled and unshifted,
+        // so the proposal can be evaluated for the whole block at once), then apply the scaling
+        // and shifting as single array operations.
+        Eigen::MatrixXd samples(dim, n);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < dim; ++j) {
+                samples(j, i) = draw1d(rng, _Ap[j]);
+            }
+        }
+        Eigen::ArrayXd logProposal = 0.5*samples.colwise().squaredNorm().transpose().array() + _pNorm;
+        samples.array().colwise() *= _rootD.array();
+        samples.colwise() += _mu;
+        for (int i = 0; i < n; ++i) {
+            Scalar logActual = (*this)(samples.col(i)) - _lnAf;
+            Scalar w = std::exp(logProposal[i] - logActual);
+            if (multiplyWeights) {
+                weights[i] *= w;
+            } else {
+                weights[i] = w;
+            }
+        }
+        ndarray::asEigenMatrix(alpha) = samples.adjoint();
+    }
+
 private:
     Scalar _pNorm; // normalization factor for full N-d importance distribution
     Scalar _lnAf; // log integral of the true N-d distribution
@@ -549,15 +719,7 @@ void TruncatedGaussianSampler::operator()(
         pex::exceptions::LengthError,
         "First dimension of alpha array (%d) does not match size of weights array (%d)"
     );
-    if (multiplyWeights) {
-        for (int i = 0, n = alpha.getSize<0>(); i < n; ++i) {
-            weights[i] *= _impl->apply(rng, alpha[i]);
-        }
-    } else {
-        for (int i = 0, n = alpha.getSize<0>(); i < n; ++i) {
-            weights[i] = _impl->apply(rng, alpha[i]);
-        }
-    }
+    _impl->applyBatch(rng, alpha, weights, multiplyWeights);
 }
 
 TruncatedGaussianSampler::~TruncatedGaussianSampler() {} // defined in .cc so it can see Impl's dtor
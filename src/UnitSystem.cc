@@ -72,6 +72,30 @@ LocalUnitTransform::LocalUnitTransform(geom::Point2D const& sourcePixel, UnitSys
                source.photoCalib->getInstFluxAtZeroMagnitude()),
           sb(flux / geometric.getLinear().computeDeterminant()) {}
 
+UnitTransformCache::UnitTransformCache(UnitSystem const& measSys)
+        : _measSys(measSys.wcs, measSys.photoCalib),  // re-validates the PhotoCalib
+          _zeroFlux(_measSys.photoCalib->getInstFluxAtZeroMagnitude()) {}
+
+UnitSystem UnitTransformCache::makeFitSys(geom::SpherePoint const& position, Scalar flux) const {
+    auto scale = 1.0 * lsst::geom::arcseconds;
+    auto cdMatrix = afw::geom::makeCdMatrix(scale);
+    auto wcs = afw::geom::makeSkyWcs(geom::Point2D(0.0, 0.0), position, cdMatrix);
+    // Equivalent to pow(10, instFluxToMagnitude(flux)/2.5) in the UnitSystem constructor.
+    auto photoCalib = afw::image::makePhotoCalibFromCalibZeroPoint(_zeroFlux / flux, 0.0);
+    return UnitSystem(wcs, photoCalib);
+}
+
+LocalUnitTransform UnitTransformCache::makeFitSysToMeasSys(geom::SpherePoint const& position,
+                                                           UnitSystem const& fitSys) const {
+    // The chain rule makes composing the two local linearizations equivalent to linearizing
+    // the composite fitSys->sky->measSys transform, without the cost of constructing it.
+    geom::AffineTransform geometric =
+            _measSys.wcs->linearizeSkyToPixel(position, lsst::geom::arcseconds) *
+            fitSys.wcs->linearizePixelToSky(position, lsst::geom::arcseconds);
+    return LocalUnitTransform(
+            geometric, _zeroFlux / fitSys.photoCalib->getInstFluxAtZeroMagnitude());
+}
+
 }  // namespace modelfit
 }  // namespace meas
 }  // namespace lsst
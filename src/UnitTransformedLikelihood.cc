@@ -21,22 +21,58 @@
  * see <http://www.lsstcorp.org/LegalNotices/>.
  */
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "boost/format.hpp"
 #include <memory>
 #include "ndarray/eigen.h"
 
+#include "lsst/afw/geom/ellipses.h"
 #include "lsst/afw/image/PhotoCalib.h"
 #include "lsst/shapelet/MatrixBuilder.h"
+#include "lsst/meas/modelfit/GaussianMatrixBuilder.h"
 #include "lsst/meas/modelfit/UnitTransformedLikelihood.h"
 
 namespace lsst { namespace meas { namespace modelfit {
 
 namespace {
 
-typedef std::vector< shapelet::MatrixBuilder<Pixel> > BuilderVector;
+/*
+ * Dispatch wrapper that evaluates one basis element through either the direct
+ * few-Gaussian kernel (when the basis and PSF are all order 0, as in the CModel
+ * initial stage with a Gaussian PSF approximation) or the general shapelet
+ * MatrixBuilder.  Exactly one of the two pointers is set.
+ */
+struct Builder {
+
+    int getBasisSize() const {
+        return gaussian ? gaussian->getBasisSize() : generic->getBasisSize();
+    }
+
+    void operator()(
+        ndarray::Array<Pixel,2,-1> const & output,
+        afw::geom::ellipses::Ellipse const & ellipse
+    ) const {
+        if (gaussian) {
+            (*gaussian)(output, ellipse);
+        } else {
+            (*generic)(output, ellipse);
+        }
+    }
+
+    std::shared_ptr<GaussianMatrixBuilder> gaussian;
+    std::shared_ptr<shapelet::MatrixBuilder<Pixel> const> generic;
+};
+
+typedef std::vector<Builder> BuilderVector;
 typedef std::vector< shapelet::MatrixBuilderFactory<Pixel> > FactoryVector;
 
 /*
@@ -48,24 +84,209 @@ int componentPixelSum(int partialNumPixels, std::shared_ptr<EpochFootprint const
 }
 
 /*
- * Return a vector of MatrixBuilders, with one for each MultiShapeletBasis in the input vector,
- * using the pixel region defined by the given Footprint and the given shapelet PSF approximation.
+ * Pool of MatrixBuilder workspaces shared by all UnitTransformedLikelihoods in the process,
+ * so constructing a likelihood for a new source (or a new fit stage) reuses a previously
+ * allocated workspace instead of making a fresh large allocation every time.  Each pooled
+ * workspace is grown in place to the high-water-mark size and handed out as a lease that
+ * returns itself to the pool when the likelihood holding it is destroyed.  A single
+ * mutex-guarded pool is used rather than strictly thread-local ones because a lease may
+ * be released from a different thread than the one that acquired it; the lock is only
+ * taken at likelihood construction and destruction, never during evaluation.
+ */
+class WorkspacePool {
+public:
+
+    typedef shapelet::MatrixBuilderWorkspace<Pixel> Workspace;
+
+    std::shared_ptr<Workspace> acquire(int size) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::shared_ptr<Entry> entry;
+        for (std::vector<std::shared_ptr<Entry>>::const_iterator i = _entries.begin();
+             i != _entries.end(); ++i) {
+            if (!(**i).inUse && (!entry || (**i).size > entry->size)) {
+                entry = *i;
+            }
+        }
+        if (!entry) {
+            entry = std::make_shared<Entry>();
+            _entries.push_back(entry);
+        }
+        if (entry->size < size) {
+            entry->workspace = std::make_shared<Workspace>(size);
+            entry->size = size;
+        }
+        entry->inUse = true;
+        // Aliasing shared_ptr: the lease points at the pooled workspace, and its deleter
+        // just marks the entry free again (the pool has static lifetime, so capturing
+        // `this` is safe).
+        return std::shared_ptr<Workspace>(
+            entry->workspace.get(),
+            [this, entry](Workspace *) { _release(*entry); }
+        );
+    }
+
+private:
+
+    struct Entry {
+        Entry() : size(0), inUse(false) {}
+        std::shared_ptr<Workspace> workspace;
+        int size;
+        bool inUse;
+    };
+
+    void _release(Entry & entry) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        entry.inUse = false;
+    }
+
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<Entry>> _entries;
+};
+
+WorkspacePool & getWorkspacePool() {
+    static WorkspacePool pool;
+    return pool;
+}
+
+/*
+ * Return a vector of Builders, with one for each MultiShapeletBasis in the input vector,
+ * using the pixel region defined by the given Footprint and the given shapelet PSF
+ * approximation.  Bases that qualify for the direct few-Gaussian kernel get one of those;
+ * the rest get general shapelet MatrixBuilders.
  *
- * basisVector - vector of MultiShapeletBasis objects; will produce one MatrixBuilder for each.
+ * basisVector - vector of MultiShapeletBasis objects; will produce one Builder for each.
  * psf - MultiShapeletFunction representation of the PSF
- * footprint - Footprint that defines the region of pixels that will be used in the fit.
+ * x, y - flattened pixel coordinates of the region that will be used in the fit.
+ * workspace - set to the pooled workspace lease backing any generic builders (left null
+ *             if there are none); must be kept alive (and not handed to
+ *             concurrently-evaluated builders) as long as they are.
  */
 BuilderVector makeMatrixBuilders(
     Model::BasisVector const & basisVector,
     shapelet::MultiShapeletFunction const & psf,
-    afw::detection::Footprint const & footprint
+    ndarray::Array<Pixel,1,1> const & x,
+    ndarray::Array<Pixel,1,1> const & y,
+    std::shared_ptr<WorkspacePool::Workspace> & workspace
 ) {
-    BuilderVector builders;
+    BuilderVector builders(basisVector.size());
     FactoryVector factories;
-    builders.reserve(basisVector.size());
-    factories.reserve(basisVector.size());
-    ndarray::Array<Pixel,1,1> x = ndarray::allocate(footprint.getArea());
-    ndarray::Array<Pixel,1,1> y = ndarray::allocate(footprint.getArea());
+    std::vector<std::size_t> genericIndices;
+    int workspaceSize = 0;
+    for (std::size_t k = 0; k < basisVector.size(); ++k) {
+        if (GaussianMatrixBuilder::isCompatible(*basisVector[k], psf)) {
+            builders[k].gaussian = std::make_shared<GaussianMatrixBuilder>(x, y, *basisVector[k], psf);
+        } else {
+            factories.push_back(shapelet::MatrixBuilderFactory<Pixel>(x, y, *basisVector[k], psf));
+            genericIndices.push_back(k);
+            workspaceSize = std::max(workspaceSize, factories.back().computeWorkspace());
+        }
+    }
+    if (!factories.empty()) {
+        workspace = getWorkspacePool().acquire(workspaceSize);
+        for (std::size_t i = 0; i < factories.size(); ++i) {
+            shapelet::MatrixBuilderWorkspace<Pixel> wsCopy(*workspace); // share workspace between builders
+            builders[genericIndices[i]].generic =
+                std::make_shared<shapelet::MatrixBuilder<Pixel> const>(factories[i](wsCopy));
+        }
+    }
+    return builders;
+}
+
+/*
+ * A contiguous run of an epoch's flattened pixels, with MatrixBuilders bound to just
+ * those pixels.  Each epoch holds a single tile covering all of its pixels unless the
+ * control's blockSize requests smaller ones; small tiles keep the scratch block used
+ * by computeFitStatistics cache-sized, and carry a bounding box so tiles far from the
+ * model ellipse can be skipped entirely.
+ */
+struct Tile {
+
+    Tile() : offset(0), nPix(0), xMin(0.0), xMax(0.0), yMin(0.0), yMax(0.0) {}
+
+    int offset;   // offset of the tile's first pixel relative to the epoch's
+    int nPix;
+    double xMin;  // bounding box of the tile's pixels, in data pixel coordinates
+    double xMax;
+    double yMin;
+    double yMax;
+    // Declared before builders so the builders (which use the workspace memory) are
+    // destroyed before the lease returns it to the pool.
+    std::shared_ptr<WorkspacePool::Workspace> workspace;
+    BuilderVector builders;
+};
+
+typedef std::vector<Tile> TileVector;
+
+/*
+ * Split an epoch's pixels into tiles of at most blockSize pixels (a single tile if
+ * blockSize <= 0), constructing MatrixBuilders bound to each tile's coordinates.
+ */
+TileVector makeTiles(
+    Model::BasisVector const & basisVector,
+    shapelet::MultiShapeletFunction const & psf,
+    ndarray::Array<Pixel,1,1> const & x,
+    ndarray::Array<Pixel,1,1> const & y,
+    int blockSize
+) {
+    int nPix = x.getSize<0>();
+    int tileSize = (blockSize > 0) ? blockSize : nPix;
+    TileVector tiles;
+    tiles.reserve(tileSize > 0 ? (nPix + tileSize - 1)/tileSize : 0);
+    for (int offset = 0; offset < nPix; offset += tileSize) {
+        Tile tile;
+        tile.offset = offset;
+        tile.nPix = std::min(tileSize, nPix - offset);
+        ndarray::Array<Pixel,1,1> xs = x[ndarray::view(offset, offset + tile.nPix)];
+        ndarray::Array<Pixel,1,1> ys = y[ndarray::view(offset, offset + tile.nPix)];
+        tile.xMin = ndarray::asEigenArray(xs).minCoeff();
+        tile.xMax = ndarray::asEigenArray(xs).maxCoeff();
+        tile.yMin = ndarray::asEigenArray(ys).minCoeff();
+        tile.yMax = ndarray::asEigenArray(ys).maxCoeff();
+        tile.builders = makeMatrixBuilders(basisVector, psf, xs, ys, tile.workspace);
+        tiles.push_back(tile);
+    }
+    return tiles;
+}
+
+/*
+ * Return true if every pixel in the tile is far enough from the PSF-convolved model
+ * ellipse that the profile there is below the level encoded in radiusFactor (see
+ * UnitTransformedLikelihoodControl::tileSkipThreshold).  The test uses a circular
+ * Gaussian bound on the convolved ellipse, so it is only conservative for profiles
+ * that fall at least as fast as a Gaussian with the same moments.
+ */
+bool skipTile(
+    Tile const & tile,
+    afw::geom::ellipses::Quadrupole const & psfMoments,
+    afw::geom::ellipses::Ellipse const & ellipse,
+    double radiusFactor
+) {
+    if (!(radiusFactor > 0.0)) return false;
+    afw::geom::ellipses::Quadrupole q(ellipse.getCore());
+    afw::geom::ellipses::Axes axes(
+        afw::geom::ellipses::Quadrupole(
+            q.getIxx() + psfMoments.getIxx(),
+            q.getIyy() + psfMoments.getIyy(),
+            q.getIxy() + psfMoments.getIxy()
+        )
+    );
+    double const r = axes.getA()*radiusFactor;
+    geom::Point2D const & center = ellipse.getCenter();
+    double const dx = std::max({tile.xMin - center.getX(), center.getX() - tile.xMax, 0.0});
+    double const dy = std::max({tile.yMin - center.getY(), center.getY() - tile.yMax, 0.0});
+    return dx*dx + dy*dy > r*r;
+}
+
+/*
+ * Flatten the pixel coordinates of a Footprint into the given x and y arrays, which
+ * are typically views into the packed coordinate buffers covering all epochs (so the
+ * coordinates end up contiguous alongside the packed data and weight arrays).
+ */
+void flattenCoordinates(
+    afw::detection::Footprint const & footprint,
+    ndarray::Array<Pixel,1,1> const & x,
+    ndarray::Array<Pixel,1,1> const & y
+) {
     int n = 0;
     for (
         auto i = footprint.getSpans()->begin();
@@ -77,17 +298,6 @@ BuilderVector makeMatrixBuilders(
             y[n] = j->getY();
         }
     }
-    int workspaceSize = 0;
-    for (Model::BasisVector::const_iterator k = basisVector.begin(); k != basisVector.end(); ++k) {
-        factories.push_back(shapelet::MatrixBuilderFactory<Pixel>(x, y, **k, psf));
-        workspaceSize = std::max(workspaceSize, factories.back().computeWorkspace());
-    }
-    shapelet::MatrixBuilderWorkspace<Pixel> workspace(workspaceSize);
-    for (FactoryVector::const_iterator i = factories.begin(); i != factories.end(); ++i) {
-        shapelet::MatrixBuilderWorkspace<Pixel> wsCopy(workspace); // share workspace between builders
-        builders.push_back((*i)(wsCopy));
-    }
-    return builders;
 }
 
 /*
@@ -101,9 +311,7 @@ BuilderVector makeMatrixBuilders(
  *  usePixelWeights - if true, weights will be per-pixel inverse sqrt(variance); if false, a constant
  *                    average value will be used
  */
-void setupArrays(
-    afw::image::MaskedImage<Pixel> const & image,
-    afw::detection::Footprint const & footprint,
+void applyWeights(
     ndarray::Array<Pixel,1,1> const & data,
     ndarray::Array<Pixel,1,1> const & variance,
     ndarray::Array<Pixel,1,1> const & weights,
@@ -111,8 +319,6 @@ void setupArrays(
     bool usePixelWeights,
     double weightsMultiplier
 ) {
-    footprint.getSpans()->flatten(data, image.getImage()->getArray(), image.getXY0());
-    footprint.getSpans()->flatten(variance, image.getVariance()->getArray(), image.getXY0());
     unweightedData.deep() = data;
     // Convert from variance to weights (1/sigma); this is actually the usual inverse-variance
     // weighting, because we implicitly square it later.
@@ -130,6 +336,93 @@ void setupArrays(
     ndarray::asEigenArray(data) *= ndarray::asEigenArray(weights);
 }
 
+void setupArrays(
+    afw::image::MaskedImage<Pixel> const & image,
+    afw::detection::Footprint const & footprint,
+    ndarray::Array<Pixel,1,1> const & data,
+    ndarray::Array<Pixel,1,1> const & variance,
+    ndarray::Array<Pixel,1,1> const & weights,
+    ndarray::Array<Pixel,1,1> const & unweightedData,
+    bool usePixelWeights,
+    double weightsMultiplier
+) {
+    footprint.getSpans()->flatten(data, image.getImage()->getArray(), image.getXY0());
+    footprint.getSpans()->flatten(variance, image.getVariance()->getArray(), image.getXY0());
+    applyWeights(data, variance, weights, unweightedData, usePixelWeights, weightsMultiplier);
+}
+
+/*
+ * Flatten the footprint's pixels at adaptive resolution: pixels within coreRadius
+ * of the given center (in the image's pixel coordinates) are kept individually,
+ * and the remaining pixels are combined into binFactor x binFactor bins.  Each
+ * bin becomes one pseudo-pixel holding the inverse-variance-weighted mean of its
+ * pixels' data, the variance of that mean, and their weighted centroid as its
+ * coordinates, so the model evaluated at the centroid is compared against the
+ * mean surface brightness there.  Core pixels come first (in span order),
+ * followed by the pseudo-pixels in bin order, so the layout is deterministic.
+ */
+void binPixels(
+    afw::image::MaskedImage<Pixel> const & image,
+    afw::detection::Footprint const & footprint,
+    geom::Point2D const & center,
+    int binFactor,
+    double coreRadius,
+    std::vector<Pixel> & xOut,
+    std::vector<Pixel> & yOut,
+    std::vector<Pixel> & dataOut,
+    std::vector<Pixel> & varianceOut
+) {
+    auto const & img = *image.getImage();
+    auto const & var = *image.getVariance();
+    int const x0 = image.getX0();
+    int const y0 = image.getY0();
+    double const r2 = coreRadius*coreRadius;
+    struct Bin {
+        Bin() : sumW(0.0), sumWD(0.0), sumWX(0.0), sumWY(0.0) {}
+        double sumW;
+        double sumWD;
+        double sumWX;
+        double sumWY;
+    };
+    auto binIndex = [binFactor](int a) {
+        return static_cast<int>(std::floor(static_cast<double>(a)/binFactor));
+    };
+    std::map<std::pair<int,int>, Bin> bins;
+    for (
+        auto s = footprint.getSpans()->begin();
+        s != footprint.getSpans()->end();
+        ++s
+    ) {
+        int const y = s->getY();
+        for (int x = s->getMinX(); x <= s->getMaxX(); ++x) {
+            Pixel const d = img(x - x0, y - y0);
+            Pixel const v = var(x - x0, y - y0);
+            double const dx = x - center.getX();
+            double const dy = y - center.getY();
+            if (dx*dx + dy*dy <= r2) {
+                xOut.push_back(x);
+                yOut.push_back(y);
+                dataOut.push_back(d);
+                varianceOut.push_back(v);
+            } else {
+                Bin & bin = bins[std::make_pair(binIndex(x), binIndex(y))];
+                double const w = 1.0/v;
+                bin.sumW += w;
+                bin.sumWD += w*d;
+                bin.sumWX += w*x;
+                bin.sumWY += w*y;
+            }
+        }
+    }
+    for (auto const & pair : bins) {
+        Bin const & bin = pair.second;
+        xOut.push_back(bin.sumWX/bin.sumW);
+        yOut.push_back(bin.sumWY/bin.sumW);
+        dataOut.push_back(bin.sumWD/bin.sumW);
+        varianceOut.push_back(1.0/bin.sumW);
+    }
+}
+
 } // anonymous
 
 EpochFootprint::EpochFootprint(
@@ -148,16 +441,44 @@ public:
     class Epoch {
     public:
 
-        Epoch(int nPix_, LocalUnitTransform const & transform_, BuilderVector const & builders_) :
-            nPix(nPix_), transform(transform_), builders(builders_) {}
+        Epoch(int nPix_, int dataOffset_, LocalUnitTransform const & transform_,
+              shapelet::MultiShapeletFunction const & psf_,
+              ndarray::Array<Pixel,1,1> const & x_, ndarray::Array<Pixel,1,1> const & y_,
+              TileVector const & tiles_) :
+            nPix(nPix_), dataOffset(dataOffset_), transform(transform_), psf(psf_),
+            x(x_), y(y_), tiles(tiles_) {}
 
         int nPix;
+        int dataOffset;
         LocalUnitTransform transform;
-        BuilderVector builders;
+        // The PSF and flattened pixel coordinates are kept so another likelihood
+        // over the same region can rebuild builders for a different model without
+        // revisiting the footprint (see the pixel-data-sharing constructor).  The
+        // coordinate arrays are shallow views into the packed per-likelihood
+        // buffers held by Impl, at the same offsets as the epoch's pixel data.
+        shapelet::MultiShapeletFunction psf;
+        ndarray::Array<Pixel,1,1> x;
+        ndarray::Array<Pixel,1,1> y;
+        // PSF moments in data pixel coordinates; only computed (and only used) when
+        // tile skipping is enabled.
+        afw::geom::ellipses::Quadrupole psfMoments;
+        TileVector tiles;
     };
 
-    Impl() : scratch(afw::geom::ellipses::Quadrupole(), geom::Point2D()) {}
+    Impl(int nThreads_, int blockSize_, double tileSkipThreshold_) :
+        nThreads(nThreads_), blockSize(blockSize_), tileSkipThreshold(tileSkipThreshold_),
+        scratch(afw::geom::ellipses::Quadrupole(), geom::Point2D()) {}
 
+    int nThreads;
+    int blockSize;
+    double tileSkipThreshold;
+    // Packed flattened pixel coordinates covering all epochs, in the same order
+    // (and at the same offsets) as the base class's packed data and weight arrays;
+    // together these form one structure-of-arrays block per likelihood, so the
+    // per-epoch evaluation loops stream linearly through memory instead of
+    // chasing a separate allocation for each epoch.
+    ndarray::Array<Pixel,1,1> x;
+    ndarray::Array<Pixel,1,1> y;
     std::vector<Epoch> epochs;
     Model::EllipseVector ellipses;
     afw::geom::ellipses::Ellipse scratch;
@@ -170,13 +491,15 @@ UnitTransformedLikelihood::UnitTransformedLikelihood(
     geom::SpherePoint const & position,
     std::vector<std::shared_ptr<EpochFootprint>> const & epochFootprintList,
     UnitTransformedLikelihoodControl const & ctrl
-) : Likelihood(model, fixed), _impl(new Impl()) {
+) : Likelihood(model, fixed), _impl(new Impl(ctrl.nThreads, ctrl.blockSize, ctrl.tileSkipThreshold)) {
     int totPixels = std::accumulate(epochFootprintList.begin(), epochFootprintList.end(),
                                     0, componentPixelSum);
     _data = ndarray::allocate(totPixels);
     _variance = ndarray::allocate(totPixels);
     _weights = ndarray::allocate(totPixels);
     _unweightedData = ndarray::allocate(totPixels);
+    _impl->x = ndarray::allocate(totPixels);
+    _impl->y = ndarray::allocate(totPixels);
     _impl->epochs.reserve(epochFootprintList.size());
     _impl->ellipses = model->makeEllipseVector();
     int dataOffset = 0;
@@ -188,12 +511,21 @@ UnitTransformedLikelihood::UnitTransformedLikelihood(
     ) {
         int nPix = (**imPtrIter).footprint.getArea();
         int dataEnd = dataOffset + nPix;
+        ndarray::Array<Pixel,1,1> x = _impl->x[ndarray::view(dataOffset, dataEnd)];
+        ndarray::Array<Pixel,1,1> y = _impl->y[ndarray::view(dataOffset, dataEnd)];
+        flattenCoordinates((**imPtrIter).footprint, x, y);
         _impl->epochs.push_back(
             Impl::Epoch(
-                nPix, LocalUnitTransform(fitPixel, fitSys, (**imPtrIter).exposure),
-                makeMatrixBuilders(model->getBasisVector(), (**imPtrIter).psf, (**imPtrIter).footprint)
+                nPix, dataOffset, LocalUnitTransform(fitPixel, fitSys, (**imPtrIter).exposure),
+                (**imPtrIter).psf, x, y,
+                makeTiles(model->getBasisVector(), (**imPtrIter).psf, x, y, _impl->blockSize)
             )
         );
+        if (_impl->tileSkipThreshold > 0.0 && _impl->blockSize > 0) {
+            _impl->epochs.back().psfMoments = afw::geom::ellipses::Quadrupole(
+                (**imPtrIter).psf.evaluate().computeMoments().getCore()
+            );
+        }
         setupArrays(
             (**imPtrIter).exposure.getMaskedImage(),
             (**imPtrIter).footprint,
@@ -204,6 +536,7 @@ UnitTransformedLikelihood::UnitTransformedLikelihood(
             ctrl.usePixelWeights,
             ctrl.weightsMultiplier
         );
+        dataOffset = dataEnd;
     }
 }
 
@@ -216,22 +549,85 @@ UnitTransformedLikelihood::UnitTransformedLikelihood(
     afw::detection::Footprint const & footprint,
     shapelet::MultiShapeletFunction const & psf,
     UnitTransformedLikelihoodControl const & ctrl
-) : Likelihood(model, fixed), _impl(new Impl()) {
-    int totPixels = footprint.getArea();
-    _data = ndarray::allocate(totPixels);
-    _variance = ndarray::allocate(totPixels);
-    _weights = ndarray::allocate(totPixels);
-    _unweightedData = ndarray::allocate(totPixels);
+) : Likelihood(model, fixed), _impl(new Impl(ctrl.nThreads, ctrl.blockSize, ctrl.tileSkipThreshold)) {
+    if (ctrl.binFactor > 1) {
+        // Adaptive resolution: full-resolution core pixels plus binned pseudo-pixels
+        // for the outskirts (see binPixels); everything downstream just sees a
+        // shorter list of coordinates with properly propagated data and variance.
+        std::vector<Pixel> xVec, yVec, dataVec, varianceVec;
+        binPixels(
+            exposure.getMaskedImage(), footprint,
+            exposure.getWcs()->skyToPixel(position),
+            ctrl.binFactor, ctrl.binCoreRadius,
+            xVec, yVec, dataVec, varianceVec
+        );
+        int totPixels = xVec.size();
+        _data = ndarray::allocate(totPixels);
+        _variance = ndarray::allocate(totPixels);
+        _weights = ndarray::allocate(totPixels);
+        _unweightedData = ndarray::allocate(totPixels);
+        _impl->x = ndarray::allocate(totPixels);
+        _impl->y = ndarray::allocate(totPixels);
+        std::copy(xVec.begin(), xVec.end(), _impl->x.begin());
+        std::copy(yVec.begin(), yVec.end(), _impl->y.begin());
+        std::copy(dataVec.begin(), dataVec.end(), _data.begin());
+        std::copy(varianceVec.begin(), varianceVec.end(), _variance.begin());
+        applyWeights(_data, _variance, _weights, _unweightedData,
+                     ctrl.usePixelWeights, ctrl.weightsMultiplier);
+    } else {
+        int totPixels = footprint.getArea();
+        _data = ndarray::allocate(totPixels);
+        _variance = ndarray::allocate(totPixels);
+        _weights = ndarray::allocate(totPixels);
+        _unweightedData = ndarray::allocate(totPixels);
+        _impl->x = ndarray::allocate(totPixels);
+        _impl->y = ndarray::allocate(totPixels);
+        flattenCoordinates(footprint, _impl->x, _impl->y);
+        setupArrays(exposure.getMaskedImage(), footprint, _data, _variance, _weights, _unweightedData,
+                    ctrl.usePixelWeights, ctrl.weightsMultiplier);
+    }
     _impl->ellipses = model->makeEllipseVector();
     geom::Point2D fitPixel = fitSys.wcs->skyToPixel(position);
     _impl->epochs.push_back(
         Impl::Epoch(
-            totPixels, LocalUnitTransform(fitPixel, fitSys, exposure),
-            makeMatrixBuilders(model->getBasisVector(), psf, footprint)
+            static_cast<int>(_impl->x.getSize<0>()), 0, LocalUnitTransform(fitPixel, fitSys, exposure),
+            psf, _impl->x, _impl->y,
+            makeTiles(model->getBasisVector(), psf, _impl->x, _impl->y, _impl->blockSize)
         )
     );
-    setupArrays(exposure.getMaskedImage(), footprint, _data, _variance, _weights, _unweightedData,
-                ctrl.usePixelWeights, ctrl.weightsMultiplier);
+    if (_impl->tileSkipThreshold > 0.0 && _impl->blockSize > 0) {
+        _impl->epochs.back().psfMoments = afw::geom::ellipses::Quadrupole(
+            psf.evaluate().computeMoments().getCore()
+        );
+    }
+}
+
+UnitTransformedLikelihood::UnitTransformedLikelihood(
+    std::shared_ptr<Model> model,
+    ndarray::Array<Scalar const,1,1> const & fixed,
+    UnitTransformedLikelihood const & other
+) : Likelihood(model, fixed),
+    _impl(new Impl(other._impl->nThreads, other._impl->blockSize, other._impl->tileSkipThreshold)) {
+    // ndarray assignment is shallow, so the pixel data is shared, not copied.
+    _data = other._data;
+    _unweightedData = other._unweightedData;
+    _variance = other._variance;
+    _weights = other._weights;
+    _impl->x = other._impl->x;
+    _impl->y = other._impl->y;
+    _impl->ellipses = model->makeEllipseVector();
+    _impl->epochs.reserve(other._impl->epochs.size());
+    for (
+        std::vector<Impl::Epoch>::const_iterator i = other._impl->epochs.begin();
+        i != other._impl->epochs.end();
+        ++i
+    ) {
+        _impl->epochs.push_back(
+            Impl::Epoch(i->nPix, i->dataOffset, i->transform, i->psf, i->x, i->y,
+                        makeTiles(model->getBasisVector(), i->psf, i->x, i->y, _impl->blockSize))
+        );
+        _impl->epochs.back().psfMoments = i->psfMoments;
+    }
 }
 
 UnitTransformedLikelihood::~UnitTransformedLikelihood() {}
@@ -241,31 +637,146 @@ void UnitTransformedLikelihood::computeModelMatrix(
     ndarray::Array<Scalar const,1,1> const & nonlinear,
     bool doApplyWeights
 ) const {
+    ++_modelMatrixCount;
     getModel()->writeEllipses(nonlinear.begin(), _fixed.begin(), _impl->ellipses.begin());
-    int dataOffset = 0;
     modelMatrix.deep() = 0.0;
+    // Each tile fills a disjoint block of rows of the model matrix and has its own
+    // MatrixBuilder workspace, so tiles may be evaluated concurrently; only the builders
+    // *within* a tile share a workspace and must stay serial.  Distributing work per tile
+    // rather than per epoch lets single-epoch fits over large footprints use all of the
+    // requested threads when blockSize tiling is enabled.
+    auto processTile = [this, &modelMatrix](
+        Impl::Epoch const & epoch, Tile const & tile, afw::geom::ellipses::Ellipse & scratch
+    ) {
+        int rowBegin = epoch.dataOffset + tile.offset;
+        int rowEnd = rowBegin + tile.nPix;
+        int amplitudeOffset = 0;
+        for (std::size_t j = 0; j < _impl->ellipses.size(); ++j) {
+            // Copy into the scratch ellipse and transform in-place rather than assigning
+            // the transformed temporary, which would heap-allocate a fresh ellipse core
+            // for every (component, tile) pair on every evaluation.
+            scratch.setCore(_impl->ellipses[j].getCore());
+            scratch.setCenter(_impl->ellipses[j].getCenter());
+            scratch.transform(epoch.transform.geometric).inPlace();
+            int amplitudeEnd = amplitudeOffset + tile.builders[j].getBasisSize();
+            tile.builders[j](
+                modelMatrix[ndarray::view(rowBegin, rowEnd)(amplitudeOffset, amplitudeEnd)],
+                scratch
+            );
+            amplitudeOffset = amplitudeEnd;
+        }
+        modelMatrix[ndarray::view(rowBegin, rowEnd)()] *= epoch.transform.flux;
+    };
+    std::vector<std::pair<Impl::Epoch const *, Tile const *>> work;
     for (
         std::vector<Impl::Epoch>::const_iterator i = _impl->epochs.begin();
         i != _impl->epochs.end();
         ++i
     ) {
-        int dataEnd = dataOffset + i->nPix;
-        int amplitudeOffset = 0;
-        for (std::size_t j = 0; j < _impl->ellipses.size(); ++j) {
-            _impl->scratch = _impl->ellipses[j].transform(i->transform.geometric);
-            int amplitudeEnd = amplitudeOffset + i->builders[j].getBasisSize();
-            i->builders[j](
-                modelMatrix[ndarray::view(dataOffset, dataEnd)(amplitudeOffset, amplitudeEnd)],
-                _impl->scratch
+        for (TileVector::const_iterator t = i->tiles.begin(); t != i->tiles.end(); ++t) {
+            work.push_back(std::make_pair(&(*i), &(*t)));
+        }
+    }
+    int nWork = work.size();
+    int nThreads = std::min(_impl->nThreads, nWork);
+    if (nThreads <= 1) {
+        for (int i = 0; i < nWork; ++i) {
+            processTile(*work[i].first, *work[i].second, _impl->scratch);
+        }
+    } else {
+        std::atomic<int> nextWork(0);
+        std::vector<std::thread> threads;
+        threads.reserve(nThreads);
+        for (int t = 0; t < nThreads; ++t) {
+            threads.emplace_back(
+                [&processTile, &work, &nextWork, nWork]() {
+                    afw::geom::ellipses::Ellipse scratch(
+                        afw::geom::ellipses::Quadrupole(), geom::Point2D()
+                    );
+                    int i;
+                    while ((i = nextWork.fetch_add(1)) < nWork) {
+                        processTile(*work[i].first, *work[i].second, scratch);
+                    }
+                }
             );
-            amplitudeOffset = amplitudeEnd;
         }
-        modelMatrix[ndarray::view(dataOffset, dataEnd)()] *= i->transform.flux;
-        dataOffset = dataEnd;
+        for (auto & thread : threads) {
+            thread.join();
+        }
     }
     if (doApplyWeights) {
         ndarray::asEigenArray(modelMatrix).colwise() *= ndarray::asEigenArray(_weights);
     }
 }
 
+Likelihood::FitStatistics UnitTransformedLikelihood::computeFitStatistics(
+    ndarray::Array<Scalar const,1,1> const & nonlinear
+) const {
+    ++_modelMatrixCount;
+    FitStatistics result(getAmplitudeDim());
+    getModel()->writeEllipses(nonlinear.begin(), _fixed.begin(), _impl->ellipses.begin());
+    double radiusFactor = 0.0;
+    if (_impl->tileSkipThreshold > 0.0 && _impl->tileSkipThreshold < 1.0) {
+        radiusFactor = std::sqrt(-2.0*std::log(_impl->tileSkipThreshold));
+    }
+    int maxPix = 0;
+    for (
+        std::vector<Impl::Epoch>::const_iterator i = _impl->epochs.begin();
+        i != _impl->epochs.end();
+        ++i
+    ) {
+        for (TileVector::const_iterator t = i->tiles.begin(); t != i->tiles.end(); ++t) {
+            maxPix = std::max(maxPix, t->nPix);
+        }
+    }
+    // Scratch block for one tile's rows of the model matrix; allocated transposed so the
+    // per-amplitude columns are contiguous, as in computeModelMatrix's output.
+    ndarray::Array<Pixel,2,2> blockT = ndarray::allocate(getAmplitudeDim(), maxPix);
+    for (
+        std::vector<Impl::Epoch>::const_iterator i = _impl->epochs.begin();
+        i != _impl->epochs.end();
+        ++i
+    ) {
+        for (TileVector::const_iterator t = i->tiles.begin(); t != i->tiles.end(); ++t) {
+            ndarray::Array<Pixel,2,1> subT = blockT[ndarray::view(0, getAmplitudeDim())(0, t->nPix)];
+            ndarray::Array<Pixel,2,-1> block = subT.transpose();
+            block.deep() = 0.0;
+            bool anyFilled = false;
+            int amplitudeOffset = 0;
+            for (std::size_t j = 0; j < _impl->ellipses.size(); ++j) {
+                // As in computeModelMatrix, transform in-place to avoid a temporary
+                // ellipse (and its heap-allocated core) per component per tile.
+                _impl->scratch.setCore(_impl->ellipses[j].getCore());
+                _impl->scratch.setCenter(_impl->ellipses[j].getCenter());
+                _impl->scratch.transform(i->transform.geometric).inPlace();
+                int amplitudeEnd = amplitudeOffset + t->builders[j].getBasisSize();
+                if (!skipTile(*t, i->psfMoments, _impl->scratch, radiusFactor)) {
+                    t->builders[j](
+                        block[ndarray::view()(amplitudeOffset, amplitudeEnd)],
+                        _impl->scratch
+                    );
+                    anyFilled = true;
+                }
+                amplitudeOffset = amplitudeEnd;
+            }
+            if (!anyFilled) continue;  // tile contributes nothing to any accumulated term
+            block.deep() *= i->transform.flux;
+            int rowBegin = i->dataOffset + t->offset;
+            int rowEnd = rowBegin + t->nPix;
+            auto a = ndarray::asEigenMatrix(block);
+            auto y = ndarray::asEigenMatrix(_unweightedData[ndarray::view(rowBegin, rowEnd)]);
+            result.modelSquared.selfadjointView<Eigen::Lower>().rankUpdate(a.adjoint().cast<Scalar>());
+            result.modelSquaredVariance += a.adjoint().cast<Scalar>() *
+                ndarray::asEigenMatrix(_variance[ndarray::view(rowBegin, rowEnd)])
+                    .cast<Scalar>().asDiagonal() *
+                a.cast<Scalar>();
+            result.modelDotData += (a.adjoint() * y).cast<Scalar>();
+            result.modelSum += a.colwise().sum().cast<Scalar>().transpose();
+        }
+    }
+    result.modelSquared = result.modelSquared.selfadjointView<Eigen::Lower>();
+    result.dataSquaredNorm = ndarray::asEigenMatrix(_unweightedData).squaredNorm();
+    return result;
+}
+
 }}} // namespace lsst::meas::modelfit
@@ -27,53 +27,6 @@
 
 namespace lsst { namespace meas { namespace modelfit { namespace detail {
 
-
-template <int N>
-typename Vandermonde<N>::RowVector
-Vandermonde<N>::eval(double x) {
-    RowVector z = RowVector::Zero();
-    double y = 1.0;
-    for (int i = 0; i < N; ++i, y *= x) {
-        z[i] = y;
-    }
-    return z;
-}
-
-template <int N>
-typename Vandermonde<N>::RowVector
-Vandermonde<N>::differentiate1(double x) {
-    RowVector z = RowVector::Zero();
-    double y = 1.0;
-    for (int i = 1; i < N; ++i, y *= x) {
-        z[i] = i*y;
-    }
-    return z;
-}
-
-template <int N>
-typename Vandermonde<N>::RowVector
-Vandermonde<N>::differentiate2(double x) {
-    RowVector z = RowVector::Zero();
-    double y = 1.0;
-    for (int i = 2; i < N; ++i, y *= x) {
-        z[i] = i*(i-1)*y;
-    }
-    return z;
-}
-
-template <int N>
-typename Vandermonde<N>::RowVector
-Vandermonde<N>::moment(double x0, double x1, int m) {
-    RowVector z = RowVector::Zero();
-    double y0 = x0;
-    double y1 = x1;
-    for (int j = 0; j < m; ++j, y0 *= x0, y1 *= x1);
-    for (int i = 0; i < N; ++i, y0 *= x0, y1 *= x1) {
-        z[i] = (y1 / (i+m+1)) - (y0 / (i+m+1));
-    }
-    return z;
-}
-
 Eigen::Vector4d solveRampPoly(double v0, double v1, double x0, double x1, double s0, double s1) {
     Eigen::Vector4d b;
     Eigen::Matrix4d m;
@@ -92,6 +45,4 @@ Eigen::Vector4d solveRampPoly(double v0, double v1, double x0, double x1, double
     return m.fullPivLu().solve(b);
 }
 
-template class Vandermonde<4>;
-
 }}}} // namespace lsst::meas::modelfit::detail
@@ -23,7 +23,6 @@
 
 #include "boost/math/special_functions/erf.hpp"
 
-#include "lsst/log/Log.h"
 #include "lsst/pex/exceptions.h"
 #include "lsst/meas/modelfit/integrals.h"
 
@@ -36,9 +35,64 @@ double phid(double z) {
     return 0.5*boost::math::erfc(-z / M_SQRT2);
 }
 
-double bvnu(double h, double k, double rho) {
-    LOG_LOGGER trace4Logger = LOG_GET("TRACE4.meas.modelfit.integrals");
-    LOGL_DEBUG(trace4Logger, "Starting bvnu: h=%g, k=%g, rho=%g", h, k, rho);
+namespace {
+
+// Fixed-capacity array type for the quadrature loops: never larger than the
+// biggest table, so all per-call temporaries stay on the stack.
+typedef Eigen::Array<double,Eigen::Dynamic,1,0,20,1> QuadArray;
+
+// Gauss-Legendre points and weights, with the doubling w -> {w0, w0},
+// x -> {1-x0, 1+x0} that the original implementation performed on every call
+// done once at static initialization.
+struct QuadratureTable {
+
+    QuadratureTable(std::initializer_list<double> w0, std::initializer_list<double> x0) :
+        w(2*w0.size()), x(2*x0.size())
+    {
+        int const n = w0.size();
+        int i = 0;
+        for (double v : w0) { w[i] = w[i + n] = v; ++i; }
+        i = 0;
+        for (double v : x0) { x[i] = 1.0 - v; x[i + n] = 1.0 + v; ++i; }
+    }
+
+    QuadArray w;
+    QuadArray x;
+};
+
+QuadratureTable const & selectTable(double absRho, BvnuAccuracy accuracy) {
+    static QuadratureTable const tables[3] = {
+        QuadratureTable(
+            {0.1713244923791705, 0.3607615730481384, 0.4679139345726904},
+            {0.9324695142031522, 0.6612093864662647, 0.2386191860831970}
+        ),
+        QuadratureTable(
+            {0.04717533638651177, 0.1069393259953183, 0.1600783285433464,
+             0.2031674267230659, 0.2334925365383547, 0.2491470458134029},
+            {0.9815606342467191, 0.9041172563704750, 0.7699026741943050,
+             0.5873179542866171, 0.3678314989981802, 0.1252334085114692}
+        ),
+        QuadratureTable(
+            {0.01761400713915212, 0.04060142980038694, 0.06267204833410906,
+             0.08327674157670475, 0.1019301198172404, 0.1181945319615184,
+             0.1316886384491766, 0.1420961093183821, 0.1491729864726037,
+             0.1527533871307259},
+            {0.9931285991850949, 0.9639719272779138, 0.9122344282513259,
+             0.8391169718222188, 0.7463319064601508, 0.6360536807265150,
+             0.5108670019508271, 0.3737060887154196, 0.2277858511416451,
+             0.07652652113349733}
+        )
+    };
+    int tier = (absRho < 0.3) ? 0 : ((absRho < 0.75) ? 1 : 2);
+    if (accuracy == BvnuAccuracy::REDUCED && tier > 0) {
+        --tier;
+    }
+    return tables[tier];
+}
+
+} // anonymous
+
+double bvnu(double h, double k, double rho, BvnuAccuracy accuracy) {
     if (h == std::numeric_limits<double>::infinity() || h == std::numeric_limits<double>::infinity()) {
         return 0.0;
     } else if (h == -std::numeric_limits<double>::infinity()) {
@@ -52,49 +106,15 @@ double bvnu(double h, double k, double rho) {
     } else if (rho == 0.0) {
         return phid(-h) * phid(-k);
     }
-    Eigen::ArrayXd w0;
-    Eigen::ArrayXd x0;
-    Eigen::ArrayXd w;
-    Eigen::ArrayXd x;
-    // setup Gauss-Legendre quadrature points and weights
-    if (std::abs(rho) < 0.3) {
-        w0.resize(3);
-        x0.resize(3);
-        w.resize(6);
-        x.resize(6);
-        w0 << 0.1713244923791705, 0.3607615730481384, 0.4679139345726904;
-        x0 << 0.9324695142031522, 0.6612093864662647, 0.2386191860831970;
-    } else if (std::abs(rho) < 0.75) {
-        w0.resize(6);
-        x0.resize(6);
-        w.resize(12);
-        x.resize(12);
-        w0 << 0.04717533638651177, 0.1069393259953183, 0.1600783285433464,
-            0.2031674267230659, 0.2334925365383547, 0.2491470458134029;
-        x0 << 0.9815606342467191, 0.9041172563704750, 0.7699026741943050,
-            0.5873179542866171, 0.3678314989981802, 0.1252334085114692;
-    } else {
-        w0.resize(10);
-        x0.resize(10);
-        w.resize(20);
-        x.resize(20);
-        w0 << .01761400713915212, 0.04060142980038694, 0.06267204833410906,
-            .08327674157670475, 0.1019301198172404, 0.1181945319615184,
-            0.1316886384491766, 0.1420961093183821, 0.1491729864726037,
-            0.1527533871307259;
-        x0 << 0.9931285991850949, 0.9639719272779138, 0.9122344282513259,
-            0.8391169718222188, 0.7463319064601508, 0.6360536807265150,
-            0.5108670019508271, 0.3737060887154196, 0.2277858511416451,
-            0.07652652113349733;
-    }
-    w << w0, w0;
-    x << 1.0 - x0, 1.0 + x0;
+    QuadratureTable const & table = selectTable(std::abs(rho), accuracy);
+    QuadArray const & w = table.w;
+    QuadArray const & x = table.x;
     double hk = h*k;
     double bvn = 0.0;
     if (std::abs(rho) < 0.925) {
         double hs = 0.5*(h*h + k*k);
         double asr = 0.5*std::asin(rho);
-        Eigen::ArrayXd sn = (asr*x).sin();
+        QuadArray sn = (asr*x).sin();
         bvn = w.matrix().dot(((sn*hk - hs)/(1.0 - sn.square())).exp().matrix());
         bvn = 0.5*bvn*asr/M_PI + phid(-h)*phid(-k);
     } else {
@@ -118,12 +138,12 @@ double bvnu(double h, double k, double rho) {
                 bvn = bvn - std::exp(-0.5*hk)*sp*b*(1.0 - c*bs*(1.0 - d*bs)/3.0);
             }
             a = 0.5*a;
-            Eigen::ArrayXd xs1 = (a*x).square();
-            Eigen::ArrayXd asr1 = -(bs/xs1 + hk)/2;
-            Eigen::Array<bool,Eigen::Dynamic,1> xi = asr1 > -100;
-            Eigen::ArrayXd asr2 = Eigen::ArrayXd::Zero(xi.cast<int>().sum());
-            Eigen::ArrayXd xs2 = Eigen::ArrayXd::Zero(asr2.size());
-            Eigen::ArrayXd w2 = Eigen::ArrayXd::Zero(asr2.size());
+            QuadArray xs1 = (a*x).square();
+            QuadArray asr1 = -(bs/xs1 + hk)/2;
+            Eigen::Array<bool,Eigen::Dynamic,1,0,20,1> xi = asr1 > -100;
+            QuadArray asr2 = QuadArray::Zero(xi.cast<int>().sum());
+            QuadArray xs2 = QuadArray::Zero(asr2.size());
+            QuadArray w2 = QuadArray::Zero(asr2.size());
             for (int i = 0, j = 0; i < x.size(); ++i) {
                 if (xi[i]) {
                     asr2[j] = asr1[i];
@@ -132,9 +152,9 @@ double bvnu(double h, double k, double rho) {
                     ++j;
                 }
             }
-            Eigen::ArrayXd sp = 1.0 + c*xs2*(1.0 + 5.0*d*xs2);
-            Eigen::ArrayXd rs = (1.0 - xs2).sqrt();
-            Eigen::ArrayXd ep = (-0.5*hk*xs2/(1.0 + rs).square()).exp()/rs;
+            QuadArray sp = 1.0 + c*xs2*(1.0 + 5.0*d*xs2);
+            QuadArray rs = (1.0 - xs2).sqrt();
+            QuadArray ep = (-0.5*hk*xs2/(1.0 + rs).square()).exp()/rs;
             bvn = (a*(w2.matrix().dot((asr2.exp()*(sp - ep)).matrix())) - bvn)/(2.0*M_PI);
         }
         if (rho > 0.0) {
@@ -149,4 +169,31 @@ double bvnu(double h, double k, double rho) {
     return std::max(0.0, std::min(1.0, bvn));
 }
 
+void bvnu(
+    ndarray::Array<double const,1,1> const & h,
+    ndarray::Array<double const,1,1> const & k,
+    ndarray::Array<double const,1,1> const & rho,
+    ndarray::Array<double,1,1> const & out,
+    BvnuAccuracy accuracy
+) {
+    LSST_THROW_IF_NE(
+        h.getSize<0>(), k.getSize<0>(),
+        pex::exceptions::LengthError,
+        "Size of h array (%d) does not match size of k array (%d)"
+    );
+    LSST_THROW_IF_NE(
+        h.getSize<0>(), rho.getSize<0>(),
+        pex::exceptions::LengthError,
+        "Size of h array (%d) does not match size of rho array (%d)"
+    );
+    LSST_THROW_IF_NE(
+        h.getSize<0>(), out.getSize<0>(),
+        pex::exceptions::LengthError,
+        "Size of h array (%d) does not match size of out array (%d)"
+    );
+    for (std::size_t i = 0; i < out.getSize<0>(); ++i) {
+        out[i] = bvnu(h[i], k[i], rho[i], accuracy);
+    }
+}
+
 }}}} // namespace lsst::meas::modelfit::detail
@@ -20,7 +20,13 @@
  * the GNU General Public License along with this program.  If not,
  * see <http://www.lsstcorp.org/LegalNotices/>.
  */
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 #include "Eigen/Eigenvalues"
 #include "boost/math/special_functions/erf.hpp"
@@ -62,18 +68,32 @@ namespace {
 class LikelihoodOptimizerObjective : public OptimizerObjective {
 public:
 
-    LikelihoodOptimizerObjective(std::shared_ptr<Likelihood> likelihood, std::shared_ptr<Prior> prior) :
+    LikelihoodOptimizerObjective(
+        std::shared_ptr<Likelihood> likelihood, std::shared_ptr<Prior> prior, bool doComputeJacobian
+    ) :
         OptimizerObjective(
             likelihood->getDataDim(), likelihood->getNonlinearDim() + likelihood->getAmplitudeDim()
         ),
-        _likelihood(likelihood), _prior(prior),
-        _modelMatrix(ndarray::allocate(likelihood->getDataDim(), likelihood->getAmplitudeDim()))
+        _likelihood(likelihood), _prior(prior), _doComputeJacobian(doComputeJacobian),
+        _modelMatrix(ndarray::allocate(likelihood->getDataDim(), likelihood->getAmplitudeDim())),
+        _memoNext(0), _memoCalls(0), _memoHits(0)
     {}
 
     void computeResiduals(
         ndarray::Array<Scalar const,1,1> const & parameters,
         ndarray::Array<Scalar,1,1> const & residuals
     ) const override {
+        ++_memoCalls;
+        // Rejected trust-region steps often revisit numerically identical
+        // parameter vectors; comparing against the last few evaluations is far
+        // cheaper than rebuilding the model matrix.
+        for (std::vector<MemoEntry>::const_iterator m = _memo.begin(); m != _memo.end(); ++m) {
+            if ((ndarray::asEigenArray(parameters) == ndarray::asEigenArray(m->parameters)).all()) {
+                ++_memoHits;
+                residuals.deep() = m->residuals;
+                return;
+            }
+        }
         int nlDim = _likelihood->getNonlinearDim();
         int ampDim = _likelihood->getAmplitudeDim();
         _likelihood->computeModelMatrix(_modelMatrix, parameters[ndarray::view(0, nlDim)]);
@@ -81,6 +101,64 @@ public:
             * ndarray::asEigenMatrix(parameters[ndarray::view(nlDim, nlDim+ampDim)]);
         auto likelihoodData = _likelihood->getData();
         ndarray::asEigenMatrix(residuals) -= ndarray::asEigenMatrix(likelihoodData).cast<Scalar>();
+        if (int(_memo.size()) < MEMO_SIZE) {
+            MemoEntry entry;
+            entry.parameters = ndarray::copy(parameters);
+            entry.residuals = ndarray::copy(residuals);
+            _memo.push_back(entry);
+        } else {
+            // Overwrite the oldest entry in place, reusing its allocations.
+            MemoEntry & entry = _memo[_memoNext];
+            entry.parameters.deep() = parameters;
+            entry.residuals.deep() = residuals;
+            _memoNext = (_memoNext + 1) % MEMO_SIZE;
+        }
+    }
+
+    std::size_t getMemoCallCount() const override { return _memoCalls; }
+
+    std::size_t getMemoHitCount() const override { return _memoHits; }
+
+    bool differentiateResiduals(
+        ndarray::Array<Scalar const,1,1> const & parameters,
+        ndarray::Array<Scalar,2,-2> const & derivatives
+    ) const override {
+        if (!_doComputeJacobian) {
+            return false;  // defer to the Optimizer's numeric fallback
+        }
+        static Scalar const ROOT_EPS = std::sqrt(std::numeric_limits<Scalar>::epsilon());
+        int const nlDim = _likelihood->getNonlinearDim();
+        int const ampDim = _likelihood->getAmplitudeDim();
+        auto der = ndarray::asEigenMatrix(derivatives);
+        // The amplitude block is analytic: the residuals are linear in the
+        // amplitudes, and the model matrix is exactly their derivative.
+        _likelihood->computeModelMatrix(_modelMatrix, parameters[ndarray::view(0, nlDim)]);
+        der.rightCols(ampDim) = ndarray::asEigenMatrix(_modelMatrix).cast<Scalar>();
+        // The nonlinear block is differenced, but only the model matrix needs
+        // recomputation per column; the data term cancels in the difference.
+        Vector base = ndarray::asEigenMatrix(_modelMatrix).cast<Scalar>()
+            * ndarray::asEigenMatrix(parameters[ndarray::view(nlDim, nlDim + ampDim)]);
+        ndarray::Array<Scalar,1,1> perturbed = ndarray::copy(parameters[ndarray::view(0, nlDim)]);
+        for (int n = 0; n < nlDim; ++n) {
+            Scalar const h = ROOT_EPS * std::max(Scalar(1.0), std::abs(parameters[n]));
+            perturbed[n] = parameters[n] + h;
+            _likelihood->computeModelMatrix(_modelMatrix, perturbed);
+            der.col(n) = (ndarray::asEigenMatrix(_modelMatrix).cast<Scalar>()
+                          * ndarray::asEigenMatrix(parameters[ndarray::view(nlDim, nlDim + ampDim)])
+                          - base) / h;
+            perturbed[n] = parameters[n];
+        }
+        return true;
+    }
+
+    std::shared_ptr<OptimizerObjective> clone() const override {
+        std::shared_ptr<Likelihood> likelihood = _likelihood->clone();
+        if (!likelihood) {
+            return nullptr;
+        }
+        // The prior is shared: clones are only required to support concurrent
+        // computeResiduals calls, which never touch it.
+        return std::make_shared<LikelihoodOptimizerObjective>(likelihood, _prior, _doComputeJacobian);
     }
 
     bool hasPrior() const override { return static_cast<bool>(_prior); }
@@ -112,18 +190,32 @@ public:
     }
 
 private:
+
+    static int const MEMO_SIZE = 4;
+
+    struct MemoEntry {
+        ndarray::Array<Scalar,1,1> parameters;
+        ndarray::Array<Scalar,1,1> residuals;
+    };
+
     std::shared_ptr<Likelihood> _likelihood;
     std::shared_ptr<Prior> _prior;
+    bool _doComputeJacobian;
     ndarray::Array<Pixel,2,-1> _modelMatrix;
+    mutable std::vector<MemoEntry> _memo;
+    mutable int _memoNext;
+    mutable std::size_t _memoCalls;
+    mutable std::size_t _memoHits;
 };
 
 } // anonymous
 
 std::shared_ptr<OptimizerObjective> OptimizerObjective::makeFromLikelihood(
     std::shared_ptr<Likelihood> likelihood,
-    std::shared_ptr<Prior> prior
+    std::shared_ptr<Prior> prior,
+    bool doComputeJacobian
 ) {
-    return std::make_shared<LikelihoodOptimizerObjective>(likelihood, prior);
+    return std::make_shared<LikelihoodOptimizerObjective>(likelihood, prior, doComputeJacobian);
 }
 
 // ----------------- Optimizer::IterationData -----------------------------------------------------------------
@@ -359,26 +451,117 @@ Optimizer::Optimizer(
         _current.objectiveValue -= std::log(_current.priorValue);
     }
     LOGL_DEBUG(trace3Logger, "Initial objective value is %g", _current.objectiveValue);
+    if (_ctrl.numDiffThreads > 1) {
+        // Per-thread objective copies for parallel numeric differentiation; if the
+        // objective cannot be cloned we silently fall back to the serial loop.
+        _numDiffObjectives.reserve(_ctrl.numDiffThreads);
+        _numDiffObjectives.push_back(_objective);
+        for (int t = 1; t < _ctrl.numDiffThreads; ++t) {
+            std::shared_ptr<Objective const> copy = _objective->clone();
+            if (!copy) {
+                _numDiffObjectives.clear();
+                break;
+            }
+            _numDiffObjectives.push_back(copy);
+        }
+    }
     _sr1b.setZero();
     _computeDerivatives();
     ndarray::asEigenMatrix(_hessian) = ndarray::asEigenMatrix(_hessian).selfadjointView<Eigen::Lower>();
 }
 
+Optimizer::Optimizer(
+    std::shared_ptr<Objective const> objective,
+    OptimizerCheckpoint const & checkpoint,
+    Control const & ctrl
+) :
+    Optimizer(objective, checkpoint.parameters, ctrl)
+{
+    if (checkpoint.trustRadius > 0.0) {
+        _trustRadius = checkpoint.trustRadius;
+    }
+    if (!checkpoint.hessian.isEmpty() && !_ctrl.noSR1Term) {
+        if (checkpoint.hessian.getSize<0>() != static_cast<std::size_t>(_objective->parameterSize) ||
+            checkpoint.hessian.getSize<1>() != static_cast<std::size_t>(_objective->parameterSize)) {
+            throw LSST_EXCEPT(
+                pex::exceptions::LengthError,
+                (boost::format("Checkpoint Hessian shape (%d, %d) does not match objective (%d)")
+                 % checkpoint.hessian.getSize<0>() % checkpoint.hessian.getSize<1>()
+                 % _objective->parameterSize).str()
+            );
+        }
+        // Seed the SR1 correction term with the difference between the checkpointed Hessian and
+        // the Gauss-Newton (+ prior) term just computed at the restart point, so the initial
+        // Hessian matches the checkpoint and later SR1 updates build on the curvature already
+        // accumulated there.
+        _sr1b = ndarray::asEigenMatrix(checkpoint.hessian) - ndarray::asEigenMatrix(_hessian);
+        ndarray::asEigenMatrix(_hessian) += _sr1b;
+    }
+}
+
+OptimizerCheckpoint Optimizer::getCheckpoint() const {
+    OptimizerCheckpoint checkpoint;
+    checkpoint.parameters = ndarray::copy(_current.parameters);
+    checkpoint.trustRadius = _trustRadius;
+    checkpoint.hessian = ndarray::copy(_hessian);
+    return checkpoint;
+}
+
 void Optimizer::_computeDerivatives() {
     auto resDer = ndarray::asEigenMatrix(_residualDerivative);
     resDer.setZero();
     _next.parameters.deep() = _current.parameters;
     if (!_objective->differentiateResiduals(_current.parameters, _residualDerivative)) {
-        for (int n = 0; n < _objective->parameterSize; ++n) {
-            double numDiffStep = _ctrl.numDiffRelStep * _next.parameters[n]
-                + _ctrl.numDiffTrustRadiusStep * _trustRadius
-                + _ctrl.numDiffAbsStep;
-            _next.parameters[n] += numDiffStep;
-            _objective->computeResiduals(_next.parameters, _next.residuals);
-            resDer.col(n) =
-                    (ndarray::asEigenMatrix(_next.residuals) - ndarray::asEigenMatrix(_current.residuals)) /
-                    numDiffStep;
-            _next.parameters[n] = _current.parameters[n];
+        if (_numDiffObjectives.size() > 1) {
+            // The derivative columns have no data dependencies, so we difference them
+            // concurrently, each thread with its own objective copy and scratch arrays.
+            int const nThreads = static_cast<int>(_numDiffObjectives.size());
+            std::vector<std::thread> threads;
+            threads.reserve(nThreads);
+            std::atomic<bool> failed(false);
+            for (int t = 0; t < nThreads; ++t) {
+                threads.emplace_back([this, t, nThreads, &failed] {
+                    try {
+                        Objective const & objective = *_numDiffObjectives[t];
+                        ndarray::Array<Scalar,1,1> parameters = ndarray::copy(_current.parameters);
+                        ndarray::Array<Scalar,1,1> residuals = ndarray::allocate(objective.dataSize);
+                        auto localResDer = ndarray::asEigenMatrix(_residualDerivative);
+                        for (int n = t; n < _objective->parameterSize; n += nThreads) {
+                            double numDiffStep = _ctrl.numDiffRelStep * parameters[n]
+                                + _ctrl.numDiffTrustRadiusStep * _trustRadius
+                                + _ctrl.numDiffAbsStep;
+                            parameters[n] += numDiffStep;
+                            objective.computeResiduals(parameters, residuals);
+                            localResDer.col(n) =
+                                    (ndarray::asEigenMatrix(residuals) -
+                                     ndarray::asEigenMatrix(_current.residuals)) / numDiffStep;
+                            parameters[n] = _current.parameters[n];
+                        }
+                    } catch (...) {
+                        failed = true;
+                    }
+                });
+            }
+            for (auto & thread : threads) { thread.join(); }
+            if (failed) {
+                throw LSST_EXCEPT(
+                    pex::exceptions::RuntimeError,
+                    "Exception raised during parallel numeric differentiation"
+                );
+            }
+        } else {
+            for (int n = 0; n < _objective->parameterSize; ++n) {
+                double numDiffStep = _ctrl.numDiffRelStep * _next.parameters[n]
+                    + _ctrl.numDiffTrustRadiusStep * _trustRadius
+                    + _ctrl.numDiffAbsStep;
+                _next.parameters[n] += numDiffStep;
+                _objective->computeResiduals(_next.parameters, _next.residuals);
+                resDer.col(n) =
+                        (ndarray::asEigenMatrix(_next.residuals) -
+                         ndarray::asEigenMatrix(_current.residuals)) /
+                        numDiffStep;
+                _next.parameters[n] = _current.parameters[n];
+            }
         }
     }
     _gradient.deep() = 0.0;
@@ -407,7 +590,8 @@ void Optimizer::removeSR1Term() {
 bool Optimizer::_stepImpl(
     int outerIterCount,
     HistoryRecorder const * recorder,
-    afw::table::BaseCatalog * history
+    afw::table::BaseCatalog * history,
+    OptimizerIterationBuffer * buffer
 ) {
     LOG_LOGGER trace5Logger = LOG_GET("TRACE5.meas.modelfit.optimizer.Optimizer");
     LOG_LOGGER trace3Logger = LOG_GET("TRACE3.meas.modelfit.optimizer.Optimizer");
@@ -418,14 +602,23 @@ bool Optimizer::_stepImpl(
         _state |= CONVERGED_GRADZERO;
         return false;
     }
+    // The Hessian and gradient are fixed for all inner iterations (only the
+    // trust radius changes), so factor once and reuse across the retries below.
+    // The Steihaug-CG solver has no factorization step to hoist.
+    if (!_ctrl.useSteihaugCG) {
+        _trSolver.setProblem(_hessian, _gradient);
+    }
     for (int innerIterCount = 0; innerIterCount < _ctrl.maxInnerIterations; ++innerIterCount) {
         LOGL_DEBUG(trace5Logger, "Starting inner iteration %d", innerIterCount);
         _state &= ~int(STATUS);
         _next.objectiveValue = 0.0;
         _next.priorValue = 1.0;
-        solveTrustRegion(
-            _step, _hessian, _gradient, _trustRadius, _ctrl.trustRegionSolverTolerance
-        );
+        if (_ctrl.useSteihaugCG) {
+            solveTrustRegionSteihaug(_step, _hessian, _gradient, _trustRadius,
+                                     _ctrl.trustRegionSolverTolerance);
+        } else {
+            _trSolver.solve(_step, _trustRadius, _ctrl.trustRegionSolverTolerance);
+        }
         ndarray::asEigenMatrix(_next.parameters) =
                 ndarray::asEigenMatrix(_current.parameters) + ndarray::asEigenMatrix(_step);
         double stepLength = ndarray::asEigenMatrix(_step).norm();
@@ -459,6 +652,7 @@ bool Optimizer::_stepImpl(
                     return false;
                 }
                 if (recorder) recorder->apply(outerIterCount, innerIterCount, *history, *this);
+                if (buffer) buffer->apply(outerIterCount, innerIterCount, *this);
                 continue;
             }
         }
@@ -511,6 +705,7 @@ bool Optimizer::_stepImpl(
                 _state |= STATUS_TR_UNCHANGED;
             }
             if (recorder) recorder->apply(outerIterCount, innerIterCount, *history, *this);
+            if (buffer) buffer->apply(outerIterCount, innerIterCount, *this);
             return true;
         }
         _state |= STATUS_STEP_REJECTED;
@@ -533,21 +728,27 @@ bool Optimizer::_stepImpl(
             return false;
         }
         if (recorder) recorder->apply(outerIterCount, innerIterCount, *history, *this);
+        if (buffer) buffer->apply(outerIterCount, innerIterCount, *this);
     }
     LOGL_DEBUG(trace3Logger, "Max inner iteration number exceeded");
     _state |= FAILED_MAX_INNER_ITERATIONS;
     return false;
 }
 
-int Optimizer::_runImpl(HistoryRecorder const * recorder, afw::table::BaseCatalog * history) {
+int Optimizer::_runImpl(
+    HistoryRecorder const * recorder,
+    afw::table::BaseCatalog * history,
+    OptimizerIterationBuffer * buffer
+) {
     LOG_LOGGER trace5Logger = LOG_GET("TRACE5.meas.modelfit.optimizer.Optimizer");
     LOG_LOGGER trace3Logger = LOG_GET("TRACE3.meas.modelfit.optimizer.Optimizer");
     if (recorder) recorder->apply(-1, -1, *history, *this);
+    if (buffer) buffer->apply(-1, -1, *this);
     int outerIterCount = 0;
     try {
         for (; outerIterCount < _ctrl.maxOuterIterations; ++outerIterCount) {
             LOGL_DEBUG(trace5Logger, "Starting outer iteration %d", outerIterCount);
-            if (!_stepImpl(outerIterCount, recorder, history)) return outerIterCount;
+            if (!_stepImpl(outerIterCount, recorder, history, buffer)) return outerIterCount;
         }
         _state |= FAILED_MAX_OUTER_ITERATIONS;
         LOGL_DEBUG(trace3Logger, "Max outer iteration number exceeded");
@@ -558,26 +759,146 @@ int Optimizer::_runImpl(HistoryRecorder const * recorder, afw::table::BaseCatalo
 }
 
 
+// ----------------- OptimizerIterationBuffer ---------------------------------------------------------------
+
+OptimizerIterationBuffer::OptimizerIterationBuffer(int parameterSize, int capacity, bool doSaveDerivatives) :
+    _size(0), _next(0),
+    _outer(capacity), _inner(capacity), _state(capacity),
+    _objective(capacity), _prior(capacity), _trust(capacity),
+    _parameters(ndarray::allocate(capacity, parameterSize))
+{
+    if (capacity <= 0 || parameterSize <= 0) {
+        throw LSST_EXCEPT(
+            pex::exceptions::LengthError,
+            (boost::format("Buffer capacity (%d) and parameter size (%d) must both be positive")
+             % capacity % parameterSize).str()
+        );
+    }
+    if (doSaveDerivatives) {
+        _derivatives = ndarray::allocate(capacity, parameterSize + parameterSize*(parameterSize + 1)/2);
+    }
+}
+
+void OptimizerIterationBuffer::apply(int outerIterCount, int innerIterCount, Optimizer const & optimizer) {
+    int const i = _next;
+    _next = (_next + 1) % getCapacity();
+    if (_size < getCapacity()) ++_size;
+    _outer[i] = outerIterCount;
+    _inner[i] = innerIterCount;
+    _state[i] = optimizer.getState();
+    _trust[i] = optimizer._trustRadius;
+    Optimizer::IterationData const * data;
+    if (!(optimizer.getState() & Optimizer::STATUS_STEP_REJECTED)) {
+        data = &optimizer._current;
+        if (!_derivatives.isEmpty()) {
+            int const n = getParameterSize();
+            ndarray::ArrayRef<Scalar,1,1> packed = _derivatives[i];
+            for (int a = 0, k = n; a < n; ++a) {
+                packed[a] = optimizer._gradient[a];
+                for (int b = 0; b <= a; ++b, ++k) {
+                    packed[k] = optimizer._hessian(a, b);
+                }
+            }
+        }
+    } else {
+        data = &optimizer._next;
+        if (!_derivatives.isEmpty()) {
+            // Slot may hold a stale entry from a previous lap around the ring; make it
+            // obviously invalid rather than misleading.
+            _derivatives[i].deep() = std::numeric_limits<Scalar>::quiet_NaN();
+        }
+    }
+    _parameters[i].deep() = data->parameters;
+    _objective[i] = data->objectiveValue;
+    _prior[i] = data->priorValue;
+}
+
+afw::table::BaseCatalog OptimizerIterationBuffer::asCatalog() const {
+    int const n = getParameterSize();
+    afw::table::Schema schema;
+    // Field names and layout deliberately match OptimizerHistoryRecorder's schema.
+    afw::table::Key<int> outerKey = schema.addField(
+        afw::table::Field<int>("outer", "current outer iteration count"), true);
+    afw::table::Key<int> innerKey = schema.addField(
+        afw::table::Field<int>("inner", "current inner iteration count"), true);
+    afw::table::Key<int> stateKey = schema.addField(
+        afw::table::Field<int>("state", "state bitflags after this step; see Optimizer::StateFlags"), true);
+    ScalarKey objectiveKey = schema.addField(
+        afw::table::Field<Scalar>("objective", "value of objective function (-ln P) at parameters"), true);
+    ScalarKey priorKey = schema.addField(
+        afw::table::Field<Scalar>("prior", "prior probability at parameters"), true);
+    ScalarKey trustKey = schema.addField(
+        afw::table::Field<Scalar>("trust", "size of trust region after this step"), true);
+    ArrayKey parametersKey = schema.addField(
+        afw::table::Field<afw::table::Array<Scalar> >("parameters", "parameter vector", n), true);
+    ArrayKey derivativesKey;
+    if (!_derivatives.isEmpty()) {
+        derivativesKey = schema.addField(
+            afw::table::Field<afw::table::Array<Scalar> >(
+                "derivatives",
+                "objective function derivatives; use unpackDerivatives() to unpack",
+                n + n*(n+1)/2
+            ),
+            true
+        );
+    }
+    afw::table::BaseCatalog catalog(schema);
+    catalog.reserve(_size);
+    int const start = (_size == getCapacity()) ? _next : 0;
+    for (int k = 0; k < _size; ++k) {
+        int const i = (start + k) % getCapacity();
+        std::shared_ptr<afw::table::BaseRecord> record = catalog.addNew();
+        record->set(outerKey, _outer[i]);
+        record->set(innerKey, _inner[i]);
+        record->set(stateKey, _state[i]);
+        record->set(objectiveKey, _objective[i]);
+        record->set(priorKey, _prior[i]);
+        record->set(trustKey, _trust[i]);
+        record->set(parametersKey, _parameters[i]);
+        if (!_derivatives.isEmpty()) {
+            record->set(derivativesKey, _derivatives[i]);
+        }
+    }
+    return catalog;
+}
+
+
 // ----------------- Trust Region solver --------------------------------------------------------------------
 
-void solveTrustRegion(
-    ndarray::Array<Scalar,1,1> const & x,
-    ndarray::Array<Scalar const,2,1> const & F,
-    ndarray::Array<Scalar const,1,1> const & g,
-    double r, double tolerance
+namespace {
+
+// Eigen's closed-form (computeDirect) eigensolver is only implemented for
+// dimensions <= 3; larger fixed sizes fall back to the iterative algorithm,
+// which still runs entirely in stack storage for fixed-size matrices.
+template <typename MatrixT>
+void computeEigh(Eigen::SelfAdjointEigenSolver<MatrixT> & eigh, MatrixT const & m, std::true_type) {
+    eigh.computeDirect(m);
+}
+
+template <typename MatrixT>
+void computeEigh(Eigen::SelfAdjointEigenSolver<MatrixT> & eigh, MatrixT const & m, std::false_type) {
+    eigh.compute(m);
+}
+
+// Shared implementation of the constrained solve, templated over the
+// eigensolver and coefficient-vector types so the dynamic TrustRegionSolver
+// and the FixedDimTrustRegionSolver instantiations compile the same algorithm,
+// the latter with all matrix dimensions known at compile time.
+template <typename Eigh, typename VectorT>
+void solveWithEigh(
+    Eigh const & eigh, VectorT const & qtg, double gNormInf,
+    double & muStored, bool & muValid,
+    ndarray::Array<Scalar,1,1> const & x, double r, double tolerance
 ) {
     static double const ROOT_EPS = std::sqrt(std::numeric_limits<double>::epsilon());
     static int const ITER_MAX = 10;
     LOG_LOGGER trace5Logger = LOG_GET("TRACE5.meas.modelfit.optimizer.Optimizer");
-    LOG_LOGGER trace3Logger = LOG_GET("TRACE3.meas.modelfit.optimizer.Optimizer");
     double const r2 = r*r;
     double const r2min = r2 * (1.0 - tolerance) * (1.0 - tolerance);
     double const r2max = r2 * (1.0 + tolerance) * (1.0 + tolerance);
-    int const d = g.getSize<0>();
-    Eigen::SelfAdjointEigenSolver<Matrix> eigh(ndarray::asEigenMatrix(F));
+    int const d = qtg.size();
     double const threshold = ROOT_EPS * eigh.eigenvalues()[d - 1];
-    Vector qtg = eigh.eigenvectors().adjoint() * ndarray::asEigenMatrix(g);
-    Vector tmp(d);
+    VectorT tmp(d);
     double mu = 0.0;
     double xsn = 0.0;
     if (eigh.eigenvalues()[0] >= threshold) {
@@ -588,15 +909,24 @@ void solveTrustRegion(
         if (xsn <= r2max) {
             LOGL_DEBUG(trace5Logger, "Ending with unconstrained solution");
             // unconstrained solution is within the constraint; no more work to do
+            muStored = 0.0;
+            muValid = true;
             return;
         }
+        if (muValid && muStored > 0.0) {
+            // warm start the secular iteration from the last constrained solve
+            mu = muStored;
+            tmp = ((eigh.eigenvalues().array() + mu).inverse() * qtg.array()).matrix();
+            ndarray::asEigenMatrix(x) = -eigh.eigenvectors() * tmp;
+            xsn = ndarray::asEigenMatrix(x).squaredNorm();
+        }
     } else {
         mu = -eigh.eigenvalues()[0] + 2.0*ROOT_EPS*eigh.eigenvalues()[d - 1];
         tmp = ((eigh.eigenvalues().array() + mu).inverse() * qtg.array()).matrix();
         int n = 0;
         while (eigh.eigenvalues()[++n] < threshold);
         LOGL_DEBUG(trace5Logger, "Starting with %d zero eigenvalue(s) (of %d)", n, d);
-        if ((qtg.head(n).array() < ROOT_EPS * ndarray::asEigenMatrix(g).lpNorm<Eigen::Infinity>()).all()) {
+        if ((qtg.head(n).array() < ROOT_EPS * gNormInf).all()) {
             ndarray::asEigenMatrix(x) = -eigh.eigenvectors().rightCols(n) * tmp.tail(n);
             xsn = ndarray::asEigenMatrix(x).squaredNorm();
             if (xsn < r2min) {
@@ -610,6 +940,8 @@ void solveTrustRegion(
                 double tau = std::sqrt(r*r - ndarray::asEigenMatrix(x).squaredNorm());
                 ndarray::asEigenMatrix(x) += tau * eigh.eigenvectors().col(0);
                 LOGL_DEBUG(trace5Logger, "Ending; Q_1^T g == 0, and ||x|| < r");
+                muStored = mu;
+                muValid = true;
                 return;
             }
             LOGL_DEBUG(trace5Logger, "Continuing; Q_1^T g == 0, but ||x|| > r");
@@ -629,7 +961,130 @@ void solveTrustRegion(
         xsn = ndarray::asEigenMatrix(x).squaredNorm();
     }
     LOGL_DEBUG(trace5Logger, "Ending at mu=%f, ||x||=%f, r=%f", mu, std::sqrt(xsn), r);
+    muStored = mu;
+    muValid = true;
     return;
 }
 
+} // anonymous
+
+template <int N>
+void FixedDimTrustRegionSolver<N>::setProblem(
+    ndarray::Array<Scalar const,2,1> const & F,
+    ndarray::Array<Scalar const,1,1> const & g
+) {
+    Eigen::Matrix<Scalar,N,N> const Fm = ndarray::asEigenMatrix(F);
+    computeEigh(_eigh, Fm, std::integral_constant<bool,(N <= 3)>());
+    _qtg = _eigh.eigenvectors().adjoint() * Eigen::Matrix<Scalar,N,1>(ndarray::asEigenMatrix(g));
+    _gNormInf = ndarray::asEigenMatrix(g).lpNorm<Eigen::Infinity>();
+    // _mu is deliberately kept: the multiplier from the previous problem is
+    // usually a good starting guess when consecutive Hessians are similar.
+}
+
+template <int N>
+void FixedDimTrustRegionSolver<N>::solve(
+    ndarray::Array<Scalar,1,1> const & x, double r, double tolerance
+) const {
+    solveWithEigh(_eigh, _qtg, _gNormInf, _mu, _muValid, x, r, tolerance);
+}
+
+template class FixedDimTrustRegionSolver<3>;
+template class FixedDimTrustRegionSolver<4>;
+
+void TrustRegionSolver::setProblem(
+    ndarray::Array<Scalar const,2,1> const & F,
+    ndarray::Array<Scalar const,1,1> const & g
+) {
+    _dim = static_cast<int>(g.getSize<0>());
+    switch (_dim) {
+    case 3: _fixed3.setProblem(F, g); return;
+    case 4: _fixed4.setProblem(F, g); return;
+    default: break;
+    }
+    _eigh.compute(ndarray::asEigenMatrix(F));
+    _qtg = _eigh.eigenvectors().adjoint() * ndarray::asEigenMatrix(g);
+    _gNormInf = ndarray::asEigenMatrix(g).lpNorm<Eigen::Infinity>();
+    // _mu is deliberately kept: the multiplier from the previous problem is
+    // usually a good starting guess when consecutive Hessians are similar.
+}
+
+void TrustRegionSolver::solve(ndarray::Array<Scalar,1,1> const & x, double r, double tolerance) const {
+    switch (_dim) {
+    case 3: _fixed3.solve(x, r, tolerance); return;
+    case 4: _fixed4.solve(x, r, tolerance); return;
+    default: break;
+    }
+    solveWithEigh(_eigh, _qtg, _gNormInf, _mu, _muValid, x, r, tolerance);
+}
+
+void solveTrustRegion(
+    ndarray::Array<Scalar,1,1> const & x,
+    ndarray::Array<Scalar const,2,1> const & F,
+    ndarray::Array<Scalar const,1,1> const & g,
+    double r, double tolerance
+) {
+    TrustRegionSolver solver;
+    solver.setProblem(F, g);
+    solver.solve(x, r, tolerance);
+}
+
+void solveTrustRegionSteihaug(
+    ndarray::Array<Scalar,1,1> const & x,
+    ndarray::Array<Scalar const,2,1> const & F,
+    ndarray::Array<Scalar const,1,1> const & g,
+    double r, double tolerance
+) {
+    LOG_LOGGER trace5Logger = LOG_GET("TRACE5.meas.modelfit.optimizer.solveTrustRegionSteihaug");
+    int const n = g.getSize<0>();
+    auto Fm = ndarray::asEigenMatrix(F);
+    Vector s = Vector::Zero(n);
+    Vector residual = -ndarray::asEigenMatrix(g);
+    Vector direction = residual;
+    double rr = residual.squaredNorm();
+    if (rr == 0.0) {  // zero gradient: the origin is already the minimizer
+        ndarray::asEigenMatrix(x) = s;
+        return;
+    }
+    double const threshold = tolerance*std::sqrt(rr);
+    double const r2 = r*r;
+    // Follow the given direction from s to the trust region boundary; used both
+    // for nonpositive curvature and when an iterate would leave the ball.
+    auto toBoundary = [&s, r2](Vector const & d) -> Vector {
+        double const sd = s.dot(d);
+        double const dd = d.squaredNorm();
+        double const tau = (std::sqrt(sd*sd + dd*(r2 - s.squaredNorm())) - sd)/dd;
+        return s + tau*d;
+    };
+    // CG needs at most n iterations in exact arithmetic; allow a few more to
+    // absorb roundoff before falling back to whatever iterate we have.
+    int const maxIterations = 2*n + 5;
+    for (int k = 0; k < maxIterations; ++k) {
+        Vector const Fd = Fm.selfadjointView<Eigen::Lower>()*direction;
+        double const curvature = direction.dot(Fd);
+        if (curvature <= 0.0) {
+            LOGL_DEBUG(trace5Logger, "Nonpositive curvature %g at iteration %d; cutting at boundary",
+                       curvature, k);
+            s = toBoundary(direction);
+            break;
+        }
+        double const alpha = rr/curvature;
+        Vector const sNext = s + alpha*direction;
+        if (sNext.squaredNorm() >= r2) {
+            LOGL_DEBUG(trace5Logger, "Iterate %d left the trust region; cutting at boundary", k);
+            s = toBoundary(direction);
+            break;
+        }
+        s = sNext;
+        residual -= alpha*Fd;
+        double const rrNext = residual.squaredNorm();
+        if (std::sqrt(rrNext) <= threshold) {
+            LOGL_DEBUG(trace5Logger, "Converged interior solution at iteration %d", k);
+            break;
+        }
+        direction = residual + (rrNext/rr)*direction;
+        rr = rrNext;
+    }
+    ndarray::asEigenMatrix(x) = s;
+}
+
 }}} // namespace lsst::meas::modelfit
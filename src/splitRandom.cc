@@ -0,0 +1,55 @@
+// -*- lsst-c++ -*-
+/*
+ * LSST Data Management System
+ * Copyright 2008-2013 LSST Corporation.
+ *
+ * This product includes software developed by the
+ * LSST Project (http://www.lsst.org/).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the LSST License Statement and
+ * the GNU General Public License along with this program.  If not,
+ * see <http://www.lsstcorp.org/LegalNotices/>.
+ */
+
+#include "lsst/meas/modelfit/splitRandom.h"
+
+namespace lsst { namespace meas { namespace modelfit {
+
+namespace {
+
+// SplitMix64 finalizer (Steele, Lea & Flood 2014): a bijective mixing function
+// whose outputs pass stringent statistical tests even for consecutive inputs,
+// which is what makes counter-style seeding with small indices safe.
+std::uint64_t mix(std::uint64_t z) {
+    z += 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+} // anonymous
+
+std::shared_ptr<afw::math::Random> splitRandom(
+    afw::math::Random const & parent,
+    std::uint64_t index1,
+    std::uint64_t index2
+) {
+    std::uint64_t const z = mix(mix(mix(parent.getSeed()) ^ index1) ^ index2);
+    // afw::math::Random reserves seed 0 to mean "seed from the environment",
+    // which would break reproducibility here, so remap it.
+    unsigned long seed = static_cast<unsigned long>(z);
+    if (seed == 0) seed = 1;
+    return std::make_shared<afw::math::Random>(parent.getAlgorithm(), seed);
+}
+
+}}} // namespace lsst::meas::modelfit
@@ -124,6 +124,140 @@ class CModelTestCase(lsst.utils.tests.TestCase):
         self.assertFalse(result.flags[result.FAILED])
         self.assertFloatsAlmostEqual(result.instFlux, self.trueFlux, rtol=0.01)
 
+    def testStats(self):
+        """Test that CModelAlgorithm accumulates timing and counter statistics
+        across calls to apply(), and that resetStats() zeroes them.
+        """
+        ctrl = lsst.meas.modelfit.CModelControl()
+        algorithm = lsst.meas.modelfit.CModelAlgorithm(ctrl)
+        self.exposure.getMaskedImage().getVariance().getArray()[:, :] = 1E-16
+        pos = self.exposure.getPsf().getAveragePosition()
+        algorithm.apply(
+            self.exposure, makeMultiShapeletCircularGaussian(self.psfSigma),
+            self.xyPosition, self.exposure.getPsf().computeShape(pos)
+        )
+        stats = algorithm.getStats()
+        for stage in (stats.initial, stats.exp, stats.dev):
+            self.assertEqual(stage.fitCount, 1)
+            self.assertGreater(stage.iterationCount, 0)
+            self.assertGreater(stage.modelMatrixCount, 0)
+            self.assertGreater(stage.time, 0.0)
+        self.assertEqual(stats.linearFitCount, 1)
+        self.assertGreater(stats.totalTime, 0.0)
+        algorithm.resetStats()
+        stats = algorithm.getStats()
+        self.assertEqual(stats.initial.fitCount, 0)
+        self.assertEqual(stats.linearFitCount, 0)
+        self.assertEqual(stats.totalTime, 0.0)
+
+    def testFastPath(self):
+        """Test that the faint-source fast path produces comparable fluxes while
+        skipping the dev nonlinear fit.
+        """
+        ctrl = lsst.meas.modelfit.CModelControl()
+        ctrl.initial.usePixelWeights = False
+        # thresholds chosen so this source always takes the fast path
+        ctrl.fastPathSNThreshold = 1E30
+        ctrl.fastPathRadiusThreshold = 1E30
+        algorithm = lsst.meas.modelfit.CModelAlgorithm(ctrl)
+        self.exposure.getMaskedImage().getVariance().getArray()[:, :] = 1E-16
+        pos = self.exposure.getPsf().getAveragePosition()
+        result = algorithm.apply(
+            self.exposure, makeMultiShapeletCircularGaussian(self.psfSigma),
+            self.xyPosition, self.exposure.getPsf().computeShape(pos)
+        )
+        self.assertFalse(result.exp.flags[result.FAILED])
+        self.assertFloatsAlmostEqual(result.exp.instFlux, self.trueFlux, rtol=0.01)
+        self.assertFalse(result.dev.flags[result.FAILED])
+        self.assertFloatsAlmostEqual(result.dev.instFlux, self.trueFlux, rtol=0.01)
+        self.assertFalse(result.flags[result.FAILED])
+        self.assertFloatsAlmostEqual(result.instFlux, self.trueFlux, rtol=0.01)
+        stats = algorithm.getStats()
+        self.assertEqual(stats.exp.fitCount, 1)
+        # the dev stage's nonlinear fit is skipped on the fast path
+        self.assertEqual(stats.dev.fitCount, 0)
+
+    def testIterationBuffer(self):
+        """Test that the ring-buffer history recorder matches the BaseCatalog
+        recorder step for step, and that a small buffer keeps the last steps.
+        """
+        ctrl = lsst.meas.modelfit.CModelControl()
+        ctrl.initial.usePixelWeights = False
+        algorithm = lsst.meas.modelfit.CModelAlgorithm(ctrl)
+        self.exposure.getMaskedImage().getVariance().getArray()[:, :] = 1E-16
+        pos = self.exposure.getPsf().getAveragePosition()
+        result = algorithm.apply(
+            self.exposure, makeMultiShapeletCircularGaussian(self.psfSigma),
+            self.xyPosition, self.exposure.getPsf().computeShape(pos)
+        )
+        objfunc = result.exp.objfunc
+        # Start somewhere off the converged point so the fit takes several steps.
+        parameters = numpy.concatenate([result.exp.nonlinear, result.exp.amplitudes])
+        parameters[:len(result.exp.nonlinear)] += 0.25
+        schema = lsst.afw.table.Schema()
+        recorder = lsst.meas.modelfit.OptimizerHistoryRecorder(schema, ctrl.exp.getModel(), True)
+        history = lsst.afw.table.BaseCatalog(schema)
+        opt1 = lsst.meas.modelfit.Optimizer(objfunc, parameters, ctrl.exp.optimizer)
+        opt1.run(recorder, history)
+        buffer = lsst.meas.modelfit.OptimizerIterationBuffer(len(parameters), 10000, True)
+        opt2 = lsst.meas.modelfit.Optimizer(objfunc, parameters, ctrl.exp.optimizer)
+        opt2.run(buffer)
+        catalog = buffer.asCatalog()
+        self.assertEqual(len(catalog), len(history))
+        self.assertGreater(len(catalog), 2)
+        for name in ("outer", "inner", "state"):
+            self.assertFloatsEqual(catalog[name], history[name])
+        for name in ("objective", "prior", "trust"):
+            self.assertFloatsAlmostEqual(catalog[name], history[name], rtol=0.0, atol=0.0)
+        self.assertFloatsEqual(catalog["parameters"], history["parameters"])
+        # derivatives are only written for accepted steps; rejected-step slots
+        # are left unset by the recorder and NaN-filled by the buffer
+        accepted = (catalog["state"] & lsst.meas.modelfit.Optimizer.STATUS_STEP_REJECTED) == 0
+        self.assertFloatsEqual(catalog["derivatives"][accepted], history["derivatives"][accepted])
+        # a buffer smaller than the history keeps only the most recent steps
+        small = lsst.meas.modelfit.OptimizerIterationBuffer(len(parameters), 3, True)
+        opt3 = lsst.meas.modelfit.Optimizer(objfunc, parameters, ctrl.exp.optimizer)
+        opt3.run(small)
+        tail = small.asCatalog()
+        self.assertEqual(len(tail), 3)
+        self.assertFloatsEqual(tail["parameters"], history["parameters"][-3:])
+        self.assertFloatsEqual(tail["outer"], history["outer"][-3:])
+
+    def testWarmStart(self):
+        """Test that warm-starting apply() from a previous result's optimizer
+        checkpoints reproduces the fit in fewer iterations.
+        """
+        ctrl = lsst.meas.modelfit.CModelControl()
+        ctrl.initial.usePixelWeights = False
+        algorithm = lsst.meas.modelfit.CModelAlgorithm(ctrl)
+        self.exposure.getMaskedImage().getVariance().getArray()[:, :] = 1E-16
+        pos = self.exposure.getPsf().getAveragePosition()
+        cold = algorithm.apply(
+            self.exposure, makeMultiShapeletCircularGaussian(self.psfSigma),
+            self.xyPosition, self.exposure.getPsf().computeShape(pos)
+        )
+        self.assertIsNotNone(cold.initial.checkpoint)
+        self.assertIsNotNone(cold.exp.checkpoint)
+        self.assertIsNotNone(cold.dev.checkpoint)
+        coldStats = algorithm.getStats()
+        coldIterations = (coldStats.initial.iterationCount + coldStats.exp.iterationCount
+                          + coldStats.dev.iterationCount)
+        algorithm.resetStats()
+        warm = algorithm.apply(
+            self.exposure, makeMultiShapeletCircularGaussian(self.psfSigma),
+            self.xyPosition, self.exposure.getPsf().computeShape(pos),
+            warmStart=cold
+        )
+        warmStats = algorithm.getStats()
+        warmIterations = (warmStats.initial.iterationCount + warmStats.exp.iterationCount
+                          + warmStats.dev.iterationCount)
+        # starting from the converged state should take far fewer steps
+        self.assertLess(warmIterations, coldIterations)
+        self.assertFalse(warm.flags[warm.FAILED])
+        self.assertFloatsAlmostEqual(warm.instFlux, cold.instFlux, rtol=0.01)
+        self.assertFloatsAlmostEqual(warm.exp.instFlux, cold.exp.instFlux, rtol=0.01)
+        self.assertFloatsAlmostEqual(warm.dev.instFlux, cold.dev.instFlux, rtol=0.01)
+
     def testVsPsfFlux(self):
         """Test that CModel produces results comparable to PsfFlux when run
         on point sources.
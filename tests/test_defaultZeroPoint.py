@@ -72,6 +72,46 @@ class DefaultZeroPointTestCase(lsst.utils.tests.TestCase):
         del self.unitWithZero
 
 
+class UnitTransformCacheTestCase(lsst.utils.tests.TestCase):
+    """Test that UnitTransformCache reproduces direct UnitSystem and
+    LocalUnitTransform construction.
+    """
+
+    def setUp(self):
+        scale = 0.2 * geom.arcseconds
+        wcs = afwGeom.makeSkyWcs(crpix=geom.Point2D(),
+                                 crval=geom.SpherePoint(45.0, 45.0, geom.degrees),
+                                 cdMatrix=afwGeom.makeCdMatrix(scale=scale, flipX=True))
+        photoCalib = afwImage.makePhotoCalibFromCalibZeroPoint(10.0**(25/2.5))
+        self.measSys = measModel.UnitSystem(wcs, photoCalib)
+        self.cache = measModel.UnitTransformCache(self.measSys)
+
+    def tearDown(self):
+        del self.measSys
+        del self.cache
+
+    def testFitSys(self):
+        flux = 65.0
+        position = self.measSys.wcs.pixelToSky(geom.Point2D(3.5, -2.25))
+        direct = measModel.UnitSystem(position, self.measSys.photoCalib, flux)
+        cached = self.cache.makeFitSys(position, flux)
+        self.assertAlmostEqual(direct.photoCalib.getInstFluxAtZeroMagnitude(),
+                               cached.photoCalib.getInstFluxAtZeroMagnitude(), places=8)
+        self.assertEqual(direct.wcs.getSkyOrigin(), cached.wcs.getSkyOrigin())
+
+    def testTransform(self):
+        flux = 65.0
+        position = self.measSys.wcs.pixelToSky(geom.Point2D(3.5, -2.25))
+        fitSys = self.cache.makeFitSys(position, flux)
+        direct = measModel.LocalUnitTransform(fitSys.wcs.getPixelOrigin(), fitSys, self.measSys)
+        cached = self.cache.makeFitSysToMeasSys(position, fitSys)
+        self.assertFloatsAlmostEqual(np.array(cached.geometric.getMatrix()),
+                                     np.array(direct.geometric.getMatrix()),
+                                     rtol=1E-6, atol=1E-8)
+        self.assertFloatsAlmostEqual(cached.flux, direct.flux, rtol=1E-8)
+        self.assertFloatsAlmostEqual(cached.sb, direct.sb, rtol=1E-6)
+
+
 class TestMemory(lsst.utils.tests.MemoryTestCase):
     pass
 
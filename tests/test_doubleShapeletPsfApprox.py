@@ -173,6 +173,39 @@ class DoubleShapeletPsfApproxTestMixin:
         self.checkBounds(msf)
         self.checkFitQuality(msf)
 
+    def testMeasureBatch(self):
+        """Check that measureBatch() matches per-record measure(), including when
+        consecutive sources realize identical PSF images (the reuse fast path).
+        """
+        schema = lsst.afw.table.SourceTable.makeMinimalSchema()
+        centroidKey = lsst.afw.table.Point2DKey.addFields(schema, "centroid", "centroid", "pixel")
+        schema.getAliasMap().set("slot_Centroid", "centroid")
+        algorithm = self.Algorithm(self.ctrl, "modelfit_DoubleShapeletPsfApprox", schema)
+        key = lsst.shapelet.MultiShapeletFunctionKey(schema["modelfit"]["DoubleShapeletPsfApprox"])
+        measCat = lsst.afw.table.SourceCatalog(schema)
+        for i in range(3):
+            record = measCat.addNew()
+            record.set(centroidKey, lsst.geom.Point2D(0.0, 0.0))
+        algorithm.measureBatch(measCat, self.exposure)
+        singleCat = lsst.afw.table.SourceCatalog(schema)
+        singleRecord = singleCat.addNew()
+        singleRecord.set(centroidKey, lsst.geom.Point2D(0.0, 0.0))
+        algorithm.measure(singleRecord, self.exposure)
+        expected = singleRecord.get(key)
+        for record in measCat:
+            self.assertFalse(record.get("modelfit_DoubleShapeletPsfApprox_flag"))
+            msf = record.get(key)
+            self.checkBounds(msf)
+            for component, expectedComponent in zip(msf.getComponents(), expected.getComponents()):
+                self.assertFloatsAlmostEqual(
+                    component.getCoefficients(), expectedComponent.getCoefficients(), rtol=1E-14
+                )
+                self.assertFloatsAlmostEqual(
+                    component.getEllipse().getParameterVector(),
+                    expectedComponent.getEllipse().getParameterVector(),
+                    rtol=1E-14
+                )
+
     def testForcedPlugin(self):
         """Run the algorithm as a forced plugin and check the quality of the fit.
         """
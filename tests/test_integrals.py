@@ -40,6 +40,24 @@ class IntegralsTestCase(lsst.utils.tests.TestCase):
             p2 = lsst.meas.modelfit.detail.bvnu(h, k, r)
             self.assertFloatsAlmostEqual(p1, p2, rtol=1E-14)
 
+    def testBVNArray(self):
+        data = numpy.loadtxt(os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                                          "reference", "bvn.txt"), delimiter=',')
+        h = numpy.ascontiguousarray(data[:, 0])
+        k = numpy.ascontiguousarray(data[:, 1])
+        rho = numpy.ascontiguousarray(data[:, 2])
+        out = numpy.zeros(data.shape[0], dtype=float)
+        lsst.meas.modelfit.detail.bvnu(h, k, rho, out)
+        self.assertFloatsAlmostEqual(out, data[:, 3], rtol=1E-14)
+
+    def testBVNReducedAccuracy(self):
+        data = numpy.loadtxt(os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                                          "reference", "bvn.txt"), delimiter=',')
+        for h, k, r, p1 in data:
+            p2 = lsst.meas.modelfit.detail.bvnu(h, k, r,
+                                                lsst.meas.modelfit.detail.BvnuAccuracy.REDUCED)
+            self.assertFloatsAlmostEqual(p1, p2, atol=1E-6)
+
 
 class TestMemory(lsst.utils.tests.MemoryTestCase):
     pass
@@ -25,6 +25,7 @@ import unittest
 import numpy
 
 import lsst.utils.tests
+import lsst.pex.exceptions
 import lsst.meas.modelfit
 
 try:
@@ -118,6 +119,96 @@ class MixtureTestCase(lsst.utils.tests.TestCase):
             self.assertFloatsAlmostEqual(x.var(), sigma * df / (df - 2), rtol=5E-2)
             self.assertLess(scipy.stats.normaltest(x)[1], 0.05)
 
+    def testParallelUpdateEM(self):
+        """Test that threaded EM updates reproduce the serial results exactly."""
+        x = numpy.random.randn(5000, 3)
+        w = numpy.random.rand(5000)
+        w /= w.sum()
+        for df in [float("inf"), 4.0]:
+            serial = self.makeRandomMixture(3, 4, df=df)
+            threaded = serial.clone()
+            self.assertEqual(serial.getUpdateThreadCount(), 1)
+            threaded.setUpdateThreadCount(4)
+            serial.updateEM(x, w)
+            threaded.updateEM(x, w)
+            for c1, c2 in zip(serial, threaded):
+                self.assertEqual(c1.weight, c2.weight)
+                self.assertFloatsEqual(c1.getMu(), c2.getMu())
+                self.assertFloatsEqual(c1.getSigma(), c2.getSigma())
+        with self.assertRaises(lsst.pex.exceptions.InvalidParameterError):
+            serial.setUpdateThreadCount(0)
+
+    def testDiagonalCovariance(self):
+        """Test the diagonal-covariance mode: detection, projection to diagonal,
+        agreement of the specialized kernels with the dense math, and preservation
+        of diagonal form through EM updates.
+        """
+        for nDim in (3, 4):  # exercises both the fixed-dimension and dynamic kernels
+            full = self.makeRandomMixture(nDim, 4)
+            self.assertFalse(full.getDiagonalCovariance())
+            self.assertFalse(any(c.isDiagonal() for c in full))
+            diag = full.clone()
+            diag.setDiagonalCovariance(True)
+            self.assertTrue(diag.getDiagonalCovariance())
+            self.assertTrue(all(c.isDiagonal() for c in diag))
+            x = numpy.random.randn(50, nDim)*3
+            p = numpy.zeros(50, dtype=float)
+            diag.evaluate(x, p)
+            expected = numpy.zeros(50, dtype=float)
+            for c in diag:
+                sigma = c.getSigma()
+                self.assertFloatsEqual(sigma, numpy.diag(numpy.diag(sigma)))
+                z = (((x - c.getMu())**2)/numpy.diag(sigma)).sum(axis=1)
+                expected += c.weight*numpy.exp(-0.5*z)/numpy.linalg.det(2.0*numpy.pi*sigma)**0.5
+            self.assertFloatsAlmostEqual(p, expected, rtol=1E-14)
+            for i in range(5):
+                self.assertFloatsAlmostEqual(diag.evaluate(x[i]), expected[i], rtol=1E-14)
+            samples = numpy.zeros((10000, nDim), dtype=float)
+            diag.draw(self.rng, samples)
+            w = numpy.full(samples.shape[0], 1.0/samples.shape[0])
+            diag.updateEM(samples, w)
+            self.assertTrue(all(c.isDiagonal() for c in diag))
+            for c in diag:
+                sigma = c.getSigma()
+                self.assertFloatsEqual(sigma, numpy.diag(numpy.diag(sigma)))
+
+    def testComponentPruning(self):
+        """Test Mahalanobis-bound component pruning: a conservative threshold
+        reproduces the exact results to round-off, and an aggressive threshold
+        only ever removes probability.
+        """
+        for nDim, df in [(2, float("inf")), (2, 8.0), (4, float("inf"))]:
+            componentList = []
+            for i in range(3):
+                mu = numpy.zeros(nDim, dtype=float)
+                mu[0] = 100.0*i
+                a = numpy.random.randn(nDim + 1, nDim)
+                sigma = numpy.dot(a.transpose(), a) + numpy.identity(nDim)
+                componentList.append(lsst.meas.modelfit.Mixture.Component(1.0, mu, sigma))
+            exact = lsst.meas.modelfit.Mixture(nDim, componentList, df)
+            pruned = exact.clone()
+            self.assertEqual(pruned.getComponentPruningThreshold(), 0.0)
+            pruned.setComponentPruningThreshold(1E-15)
+            x = numpy.random.randn(300, nDim)*2
+            x[:, 0] += numpy.random.choice([0.0, 100.0, 200.0], size=x.shape[0])
+            pExact = numpy.zeros(x.shape[0], dtype=float)
+            pPruned = numpy.zeros(x.shape[0], dtype=float)
+            exact.evaluate(x, pExact)
+            pruned.evaluate(x, pPruned)
+            self.assertFloatsAlmostEqual(pPruned, pExact, rtol=1E-12)
+            for i in range(5):
+                self.assertFloatsAlmostEqual(pruned.evaluate(x[i]), pExact[i], rtol=1E-12)
+            aggressive = exact.clone()
+            aggressive.setComponentPruningThreshold(0.5)
+            pAggressive = numpy.zeros(x.shape[0], dtype=float)
+            aggressive.evaluate(x, pAggressive)
+            self.assertTrue(numpy.all(pAggressive <= pExact))
+            far = numpy.full((1, nDim), -1000.0)
+            pFar = numpy.zeros(1, dtype=float)
+            aggressive.evaluate(far, pFar)
+            self.assertEqual(pFar[0], 0.0)
+            self.assertEqual(aggressive.evaluate(far[0]), 0.0)
+
     def testPersistence(self):
         """Test table-based persistence of Mixtures"""
         filename = "testMixturePersistence.fits"
@@ -132,6 +223,22 @@ class MixtureTestCase(lsst.utils.tests.TestCase):
             self.assertFloatsAlmostEqual(c1.getSigma(), c2.getSigma())
         os.remove(filename)
 
+    def testCompactPersistence(self):
+        """Test the flat binary (mmap-loaded) persistence of Mixtures"""
+        filename = "testMixtureCompactPersistence.dat"
+        mix1 = self.makeRandomMixture(3, 4, df=3.5)
+        mix1.writeCompact(filename)
+        mix2 = lsst.meas.modelfit.Mixture.readCompact(filename)
+        self.assertEqual(mix1.getDegreesOfFreedom(), mix2.getDegreesOfFreedom())
+        self.assertEqual(len(mix1), len(mix2))
+        for c1, c2 in zip(mix1, mix2):
+            self.assertFloatsAlmostEqual(c1.weight, c2.weight)
+            self.assertFloatsAlmostEqual(c1.getMu(), c2.getMu())
+            self.assertFloatsAlmostEqual(c1.getSigma(), c2.getSigma())
+        os.remove(filename)
+        with self.assertRaises(lsst.pex.exceptions.IoError):
+            lsst.meas.modelfit.Mixture.readCompact(filename)
+
     def testDerivatives(self):
         epsilon = 1E-6
         g = self.makeRandomMixture(3, 4)
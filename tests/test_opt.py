@@ -73,6 +73,95 @@ class OptimizerTestCase(lsst.utils.tests.TestCase):
                 lsst.meas.modelfit.solveTrustRegion(x, f, g, r, tolerance)
                 self.assertLessEqual(numpy.linalg.norm(x), r * (1.0 + tolerance))
 
+    def testSteihaugTrustRegionSolver(self):
+        """Test the truncated-CG solver: it must stay within the trust region,
+        match the near-exact solver when the Newton step is interior, and never
+        do worse than the dense solver's model reduction by more than the
+        truncation allows.
+        """
+        tolerance = 1E-10
+        m = numpy.random.randn(60, 8)
+        y = numpy.random.randn(60)
+        f = numpy.dot(m.transpose(), m)
+        g = numpy.dot(m.transpose(), y)
+        x1 = numpy.zeros(8)
+        x2 = numpy.zeros(8)
+
+        def model(x):
+            return numpy.dot(g, x) + 0.5*numpy.dot(x, numpy.dot(f, x))
+
+        # Interior case: a generous radius makes CG converge to the Newton step.
+        newton = numpy.linalg.solve(f, -g)
+        r = 2.0*numpy.linalg.norm(newton)
+        lsst.meas.modelfit.solveTrustRegionSteihaug(x1, f, g, r, tolerance)
+        self.assertFloatsAlmostEqual(x1, newton, rtol=1E-6, atol=1E-8)
+        # Boundary cases: the step must respect the constraint and reduce the
+        # quadratic model (positive-definite f, so any zero-respecting cut does).
+        log.info("Testing solveTrustRegionSteihaug with positive-definite matrices")
+        for r in numpy.linspace(1E-3, 0.8, 5):
+            lsst.meas.modelfit.solveTrustRegionSteihaug(x1, f, g, r, tolerance)
+            self.assertLessEqual(numpy.linalg.norm(x1), r*(1.0 + 1E-8))
+            self.assertLess(model(x1), 0.0)
+        log.info("Testing solveTrustRegionSteihaug with indefinite matrices")
+        for i in range(3):
+            m = numpy.random.randn(8, 8)
+            f = m + m.transpose()
+            g = numpy.random.randn(8)
+            for r in numpy.linspace(1E-3, 0.8, 5):
+                lsst.meas.modelfit.solveTrustRegionSteihaug(x1, f, g, r, tolerance)
+                self.assertLessEqual(numpy.linalg.norm(x1), r*(1.0 + 1E-8))
+                self.assertLess(model(x1), 0.0)
+                # the near-exact solver can only do better
+                lsst.meas.modelfit.solveTrustRegion(x2, f, g, r, 1E-6)
+                self.assertLessEqual(model(x2), model(x1) + 1E-8)
+
+    def testStatefulTrustRegionSolver(self):
+        """Test that repeated solves against one factorization match the
+        one-shot solveTrustRegion results."""
+        tolerance = 1E-6
+        m = numpy.random.randn(30, 5)
+        y = numpy.random.randn(30)
+        f = numpy.dot(m.transpose(), m)
+        g = numpy.dot(m.transpose(), y)
+        solver = lsst.meas.modelfit.TrustRegionSolver()
+        solver.setProblem(f, g)
+        x1 = numpy.zeros(5)
+        x2 = numpy.zeros(5)
+        # shrinking radii, as in the optimizer's inner iterations
+        for r in numpy.linspace(0.8, 1E-3, 5):
+            solver.solve(x1, r, tolerance)
+            lsst.meas.modelfit.solveTrustRegion(x2, f, g, r, tolerance)
+            self.assertLessEqual(numpy.linalg.norm(x1), r * (1.0 + tolerance))
+            self.assertFloatsAlmostEqual(x1, x2, rtol=1E-8, atol=1E-8)
+
+    def testFixedDimTrustRegionSolver(self):
+        """Test the fixed-dimension specializations selected automatically for
+        3- and 4-parameter problems, checking the KKT conditions of the
+        constrained solution directly: (f + mu*I) x = -g with mu >= 0, and
+        mu = 0 for interior solutions."""
+        tolerance = 1E-6
+        for n in (3, 4):
+            m = numpy.random.randn(30, n)
+            y = numpy.random.randn(30)
+            problems = [(numpy.dot(m.transpose(), m), numpy.dot(m.transpose(), y))]
+            a = numpy.random.randn(n, n)
+            problems.append((a + a.transpose(), numpy.random.randn(n)))
+            x = numpy.zeros(n)
+            for f, g in problems:
+                for r in numpy.linspace(1E-3, 0.8, 5):
+                    lsst.meas.modelfit.solveTrustRegion(x, f, g, r, tolerance)
+                    norm = numpy.linalg.norm(x)
+                    gNorm = numpy.linalg.norm(g)
+                    self.assertLessEqual(norm, r*(1.0 + tolerance))
+                    residual = numpy.dot(f, x) + g
+                    if norm < r*(1.0 - tolerance):
+                        # interior solution: must be the unconstrained minimum
+                        self.assertFloatsAlmostEqual(residual, 0.0, atol=1E-8*gNorm)
+                    else:
+                        mu = -numpy.dot(residual, x)/numpy.dot(x, x)
+                        self.assertGreater(mu, -1E-8*gNorm)
+                        self.assertFloatsAlmostEqual(residual + mu*x, 0.0, atol=1E-6*gNorm)
+
 
 class TestMemory(lsst.utils.tests.MemoryTestCase):
     pass
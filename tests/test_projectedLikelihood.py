@@ -266,6 +266,152 @@ class UnitTransformedLikelihoodTestCase(lsst.utils.tests.TestCase):
                                                            efv, ctrl)
         self.checkLikelihood(l1d, data*weights)
 
+    def testAdaptiveBinning(self):
+        """Test the adaptive pixel-binning mode: a core radius that covers the
+        whole footprint reproduces the full-resolution arrays exactly, and a
+        small core shrinks the data vector while conserving the
+        inverse-variance-weighted sums.
+        """
+        ctrl = lsst.meas.modelfit.UnitTransformedLikelihoodControl()
+        ctrl.usePixelWeights = True
+        ref = lsst.meas.modelfit.UnitTransformedLikelihood(
+            self.model, self.fixed, self.sys0, self.position,
+            self.exposure0, self.footprint0, self.psf0, ctrl)
+        ctrl.binFactor = 2
+        ctrl.binCoreRadius = 1E6
+        unbinned = lsst.meas.modelfit.UnitTransformedLikelihood(
+            self.model, self.fixed, self.sys0, self.position,
+            self.exposure0, self.footprint0, self.psf0, ctrl)
+        self.assertEqual(unbinned.getDataDim(), ref.getDataDim())
+        self.assertFloatsEqual(unbinned.getUnweightedData(), ref.getUnweightedData())
+        self.assertFloatsEqual(unbinned.getVariance(), ref.getVariance())
+        ctrl.binCoreRadius = 10.0
+        binned = lsst.meas.modelfit.UnitTransformedLikelihood(
+            self.model, self.fixed, self.sys0, self.position,
+            self.exposure0, self.footprint0, self.psf0, ctrl)
+        self.assertLess(binned.getDataDim(), ref.getDataDim())
+        refW = 1.0/ref.getVariance().astype(numpy.float64)
+        binnedW = 1.0/binned.getVariance().astype(numpy.float64)
+        self.assertFloatsAlmostEqual(binnedW.sum(), refW.sum(), rtol=1E-4)
+        self.assertFloatsAlmostEqual(
+            (binned.getUnweightedData().astype(numpy.float64)*binnedW).sum(),
+            (ref.getUnweightedData().astype(numpy.float64)*refW).sum(), rtol=1E-4)
+
+    def testGaussianMatrixBuilder(self):
+        """Test that the direct few-Gaussian kernel agrees with evaluating the
+        convolved basis through the general shapelet machinery.
+        """
+        basis = lsst.shapelet.MultiShapeletBasis(2)
+        basis.addComponent(0.7, 0, numpy.array([[1.0, 0.25]], dtype=float))
+        basis.addComponent(1.5, 0, numpy.array([[0.0, 1.0]], dtype=float))
+        psf = lsst.shapelet.MultiShapeletFunction()
+        inner = lsst.shapelet.ShapeletFunction(
+            0, lsst.shapelet.HERMITE,
+            lsst.afw.geom.ellipses.Ellipse(lsst.afw.geom.ellipses.Quadrupole(4.0, 3.0, 0.5)))
+        inner.getCoefficients()[0] = 0.8
+        outer = lsst.shapelet.ShapeletFunction(
+            0, lsst.shapelet.HERMITE,
+            lsst.afw.geom.ellipses.Ellipse(lsst.afw.geom.ellipses.Quadrupole(9.0, 8.0, -1.0),
+                                           lsst.geom.Point2D(0.3, -0.2)))
+        outer.getCoefficients()[0] = 0.2
+        psf.addComponent(inner)
+        psf.addComponent(outer)
+        self.assertTrue(lsst.meas.modelfit.GaussianMatrixBuilder.isCompatible(basis, psf))
+        bbox = lsst.geom.Box2I(lsst.geom.Point2I(-25, -25), lsst.geom.Point2I(25, 25))
+        yg, xg = numpy.meshgrid(
+            numpy.arange(bbox.getMinY(), bbox.getMaxY() + 1),
+            numpy.arange(bbox.getMinX(), bbox.getMaxX() + 1),
+            indexing="ij")
+        x = xg.ravel().astype(lsst.meas.modelfit.Pixel)
+        y = yg.ravel().astype(lsst.meas.modelfit.Pixel)
+        builder = lsst.meas.modelfit.GaussianMatrixBuilder(x, y, basis, psf)
+        self.assertEqual(builder.getBasisSize(), 2)
+        self.assertEqual(builder.getDataSize(), x.size)
+        ellipse = lsst.afw.geom.ellipses.Ellipse(
+            lsst.afw.geom.ellipses.Axes(6.0, 5.0, numpy.pi/6), lsst.geom.Point2D(1.5, -2.0))
+        matrix = numpy.zeros((x.size, 2), dtype=lsst.meas.modelfit.Pixel)
+        builder(matrix, ellipse)
+        expected = numpy.zeros_like(matrix, dtype=float)
+        for a in range(2):
+            amplitudes = numpy.zeros(2, dtype=float)
+            amplitudes[a] = 1.0
+            msf = basis.makeFunction(ellipse, amplitudes).convolve(psf)
+            image = lsst.afw.image.ImageD(bbox)
+            msf.evaluate().addToImage(image)
+            expected[:, a] = image.getArray().ravel()
+        self.assertFloatsAlmostEqual(matrix, expected, rtol=1E-5, atol=1E-8, **ASSERT_CLOSE_KWDS)
+        # a nonzero-order component anywhere disqualifies the fast path
+        mixed = lsst.shapelet.MultiShapeletFunction()
+        higher = lsst.shapelet.ShapeletFunction(2, lsst.shapelet.HERMITE, 2.0)
+        higher.getCoefficients()[0] = 1.0
+        mixed.addComponent(higher)
+        self.assertFalse(lsst.meas.modelfit.GaussianMatrixBuilder.isCompatible(basis, mixed))
+
+    def checkFitStatistics(self, likelihood):
+        matrix = numpy.zeros((1, likelihood.getDataDim()), dtype=lsst.meas.modelfit.Pixel).transpose()
+        likelihood.computeModelMatrix(matrix, self.nonlinear, False)
+        y = likelihood.getUnweightedData()
+        variance = likelihood.getVariance()
+        stats = likelihood.computeFitStatistics(self.nonlinear)
+        self.assertFloatsAlmostEqual(stats.modelSquared,
+                                     numpy.dot(matrix.transpose(), matrix).astype(float),
+                                     rtol=1E-5, **ASSERT_CLOSE_KWDS)
+        self.assertFloatsAlmostEqual(stats.modelSquaredVariance,
+                                     numpy.dot(matrix.transpose()*variance, matrix).astype(float),
+                                     rtol=1E-5, **ASSERT_CLOSE_KWDS)
+        self.assertFloatsAlmostEqual(stats.modelDotData,
+                                     numpy.dot(matrix.transpose(), y).astype(float),
+                                     rtol=1E-5, **ASSERT_CLOSE_KWDS)
+        self.assertFloatsAlmostEqual(stats.modelSum, matrix.sum(axis=0).astype(float),
+                                     rtol=1E-5, **ASSERT_CLOSE_KWDS)
+        self.assertFloatsAlmostEqual(stats.dataSquaredNorm, float(numpy.dot(y, y)),
+                                     rtol=1E-5, **ASSERT_CLOSE_KWDS)
+
+    def testFitStatistics(self):
+        """Test that the fused fit statistics agree with explicit model-matrix products."""
+        ctrl = lsst.meas.modelfit.UnitTransformedLikelihoodControl()
+        likelihood = lsst.meas.modelfit.UnitTransformedLikelihood(
+            self.model, self.fixed, self.sys0, self.position,
+            self.exposure0, self.footprint0, self.psf0, ctrl)
+        self.checkFitStatistics(likelihood)
+        # two epochs, to exercise the blocked accumulation across epochs
+        efv = [lsst.meas.modelfit.EpochFootprint(self.footprint0, self.exposure0, self.psf0),
+               lsst.meas.modelfit.EpochFootprint(self.footprint0, self.exposure0, self.psf0)]
+        likelihood = lsst.meas.modelfit.UnitTransformedLikelihood(self.model, self.fixed, self.sys0,
+                                                                  self.position, efv, ctrl)
+        self.checkFitStatistics(likelihood)
+
+    def testTiledEvaluation(self):
+        """Test that tiled evaluation matches the single-tile path."""
+        ctrl = lsst.meas.modelfit.UnitTransformedLikelihoodControl()
+        ref = lsst.meas.modelfit.UnitTransformedLikelihood(
+            self.model, self.fixed, self.sys0, self.position,
+            self.exposure0, self.footprint0, self.psf0, ctrl)
+        refMatrix = numpy.zeros((1, ref.getDataDim()), dtype=lsst.meas.modelfit.Pixel).transpose()
+        ref.computeModelMatrix(refMatrix, self.nonlinear)
+        refStats = ref.computeFitStatistics(self.nonlinear)
+        # awkward tile size so the last tile is partial
+        ctrl.blockSize = 93
+        tiled = lsst.meas.modelfit.UnitTransformedLikelihood(
+            self.model, self.fixed, self.sys0, self.position,
+            self.exposure0, self.footprint0, self.psf0, ctrl)
+        matrix = numpy.zeros((1, tiled.getDataDim()), dtype=lsst.meas.modelfit.Pixel).transpose()
+        tiled.computeModelMatrix(matrix, self.nonlinear)
+        self.assertFloatsEqual(matrix, refMatrix)
+        self.checkFitStatistics(tiled)
+        stats = tiled.computeFitStatistics(self.nonlinear)
+        self.assertFloatsAlmostEqual(stats.modelSquared, refStats.modelSquared, rtol=1E-6)
+        self.assertFloatsAlmostEqual(stats.modelDotData, refStats.modelDotData, rtol=1E-6)
+        # a tiny skip threshold should leave the statistics essentially unchanged
+        ctrl.tileSkipThreshold = 1E-12
+        skipping = lsst.meas.modelfit.UnitTransformedLikelihood(
+            self.model, self.fixed, self.sys0, self.position,
+            self.exposure0, self.footprint0, self.psf0, ctrl)
+        stats = skipping.computeFitStatistics(self.nonlinear)
+        self.assertFloatsAlmostEqual(stats.modelSquared, refStats.modelSquared, rtol=1E-5)
+        self.assertFloatsAlmostEqual(stats.modelDotData, refStats.modelDotData, rtol=1E-5)
+        self.assertFloatsAlmostEqual(stats.modelSum, refStats.modelSum, rtol=1E-5)
+
 
 class TestMemory(lsst.utils.tests.MemoryTestCase):
     pass
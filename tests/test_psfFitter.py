@@ -271,6 +271,75 @@ class GeneralPsfFitterTestCase(lsst.utils.tests.TestCase):
                                              atol=tolerances[configKey],
                                              plotOnFailure=True)
 
+    def testParallelNumDiff(self):
+        """Test that parallel numeric differentiation reproduces the serial fit
+        exactly: the derivative columns are computed identically, just on
+        different threads.
+        """
+        filename = sorted(glob.glob(os.path.join(DATA_DIR, "psfs", "great3*.fits")))[0]
+        kernelImage = lsst.afw.image.ImageD(filename)
+        shape = computeMoments(kernelImage)
+        serialFitter = lsst.meas.modelfit.GeneralPsfFitter(self.configs['ellipse'].makeControl())
+        serialFit = serialFitter.apply(kernelImage, shape, 0.01)
+        config = self.configs['ellipse']
+        config.optimizer.numDiffThreads = 4
+        parallelFitter = lsst.meas.modelfit.GeneralPsfFitter(config.makeControl())
+        parallelFit = parallelFitter.apply(kernelImage, shape, 0.01)
+        for serialComponent, parallelComponent in zip(serialFit.getComponents(),
+                                                      parallelFit.getComponents()):
+            self.assertFloatsEqual(numpy.array(serialComponent.getCoefficients()),
+                                   numpy.array(parallelComponent.getCoefficients()))
+            self.assertFloatsEqual(serialComponent.getEllipse().getParameterVector(),
+                                   parallelComponent.getEllipse().getParameterVector())
+
+    def testWarmStartCache(self):
+        filename = sorted(glob.glob(os.path.join(DATA_DIR, "psfs", "great3*.fits")))[0]
+        kernelImage = lsst.afw.image.ImageD(filename)
+        shape = computeMoments(kernelImage)
+        config = self.configs['ellipse']
+        config.warmStartRadius = 50.0
+        fitter = lsst.meas.modelfit.GeneralPsfFitter(config.makeControl())
+        self.assertEqual(fitter.getCacheSize(), 0)
+        cold = fitter.apply(kernelImage, shape, lsst.geom.Point2D(100.0, 100.0), 0.01)
+        self.assertEqual(fitter.getCacheSize(), 1)
+        # Within the search radius: warm-started from the first fit, but the image is the
+        # same, so it should land on (essentially) the same optimum.
+        warm = fitter.apply(kernelImage, shape, lsst.geom.Point2D(110.0, 100.0), 0.01)
+        self.assertEqual(fitter.getCacheSize(), 2)
+        for coldComponent, warmComponent in zip(cold.getComponents(), warm.getComponents()):
+            self.assertFloatsAlmostEqual(numpy.array(coldComponent.getCoefficients()),
+                                         numpy.array(warmComponent.getCoefficients()),
+                                         atol=1E-4)
+        # Outside the search radius: cold start again, but still added to the cache.
+        fitter.apply(kernelImage, shape, lsst.geom.Point2D(500.0, 500.0), 0.01)
+        self.assertEqual(fitter.getCacheSize(), 3)
+        fitter.clearCache()
+        self.assertEqual(fitter.getCacheSize(), 0)
+
+    def testCoarsePass(self):
+        """Test that the coarse-to-fine mode lands on (essentially) the same
+        optimum as a direct cold-start fit: the coarse stage is only a warm
+        start, so it must not change what we converge to.
+        """
+        filename = sorted(glob.glob(os.path.join(DATA_DIR, "psfs", "great3*.fits")))[0]
+        kernelImage = lsst.afw.image.ImageD(filename)
+        shape = computeMoments(kernelImage)
+        directFitter = lsst.meas.modelfit.GeneralPsfFitter(self.configs['full'].makeControl())
+        directFit = directFitter.apply(kernelImage, shape, 0.01)
+        config = self.configs['full']
+        config.doCoarsePass = True
+        config.coarseBinFactor = 2
+        coarseFitter = lsst.meas.modelfit.GeneralPsfFitter(config.makeControl())
+        coarseFit = coarseFitter.apply(kernelImage, shape, 0.01)
+        for directComponent, coarseComponent in zip(directFit.getComponents(),
+                                                    coarseFit.getComponents()):
+            self.assertFloatsAlmostEqual(numpy.array(directComponent.getCoefficients()),
+                                         numpy.array(coarseComponent.getCoefficients()),
+                                         atol=1E-4)
+            self.assertFloatsAlmostEqual(directComponent.getEllipse().getParameterVector(),
+                                         coarseComponent.getEllipse().getParameterVector(),
+                                         atol=1E-4)
+
 
 class TestMemory(lsst.utils.tests.MemoryTestCase):
     pass
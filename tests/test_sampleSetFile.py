@@ -0,0 +1,116 @@
+#
+# LSST Data Management System
+#
+# Copyright 2008-2016  AURA/LSST.
+#
+# This product includes software developed by the
+# LSST Project (http://www.lsst.org/).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the LSST License Statement and
+# the GNU General Public License along with this program.  If not,
+# see <https://www.lsstcorp.org/LegalNotices/>.
+#
+import os
+import tempfile
+import unittest
+
+import numpy
+
+import lsst.utils.tests
+import lsst.afw.table
+import lsst.meas.modelfit
+
+
+def makeSampleCatalog(nSamples, parameterDim):
+    schema = lsst.afw.table.Schema()
+    schema.addField("weight", type=lsst.meas.modelfit.Scalar, doc="normalized weight")
+    schema.addField("objective", type=lsst.meas.modelfit.Scalar, doc="-log posterior")
+    schema.addField("proposal", type=lsst.meas.modelfit.Scalar, doc="-log proposal density")
+    schema.addField("parameters", type="ArrayD", size=parameterDim, doc="nonlinear parameters")
+    catalog = lsst.afw.table.BaseCatalog(schema)
+    for k in range(nSamples):
+        record = catalog.addNew()
+        record["weight"] = numpy.random.rand()
+        record["objective"] = numpy.random.randn()
+        record["proposal"] = numpy.random.randn()
+        record["parameters"] = numpy.random.randn(parameterDim)
+    return catalog
+
+
+class SampleSetFileTestCase(lsst.utils.tests.TestCase):
+
+    def setUp(self):
+        numpy.random.seed(500)
+        fd, self.filename = tempfile.mkstemp(suffix=".samples")
+        os.close(fd)
+
+    def tearDown(self):
+        if os.path.exists(self.filename):
+            os.remove(self.filename)
+
+    def testRoundTrip(self):
+        parameterDim = 3
+        catalogs = [makeSampleCatalog(n, parameterDim) for n in (7, 1, 12)]
+        writer = lsst.meas.modelfit.SampleSetWriter(self.filename, parameterDim)
+        self.assertEqual(writer.getParameterDim(), parameterDim)
+        writer.append(catalogs[0])
+        writer.append(catalogs[1], id=42)
+        writer.append(catalogs[2])
+        self.assertEqual(writer.getBlockCount(), 3)
+        writer.close()
+        blocks = lsst.meas.modelfit.readSampleSetFile(self.filename)
+        self.assertEqual(len(blocks), 3)
+        self.assertEqual([b.id for b in blocks], [0, 42, 2])
+        for block, catalog in zip(blocks, catalogs):
+            self.assertEqual(block.weight.shape, (len(catalog),))
+            self.assertEqual(block.parameters.shape, (len(catalog), parameterDim))
+            self.assertFloatsEqual(block.weight, catalog["weight"])
+            self.assertFloatsEqual(block.objective, catalog["objective"])
+            self.assertFloatsEqual(block.proposal, catalog["proposal"])
+            for k, record in enumerate(catalog):
+                self.assertFloatsEqual(block.parameters[k], record["parameters"])
+
+    def testTruncatedFile(self):
+        # A file that ends mid-block should read cleanly up to the last
+        # complete block, as after an interrupted run.
+        parameterDim = 2
+        catalog = makeSampleCatalog(10, parameterDim)
+        writer = lsst.meas.modelfit.SampleSetWriter(self.filename, parameterDim)
+        writer.append(catalog)
+        writer.append(catalog)
+        writer.close()
+        size = os.path.getsize(self.filename)
+        with open(self.filename, "r+b") as f:
+            f.truncate(size - 24)
+        blocks = lsst.meas.modelfit.readSampleSetFile(self.filename)
+        self.assertEqual(len(blocks), 1)
+        self.assertFloatsEqual(blocks[0].weight, catalog["weight"])
+
+    def testBadFiles(self):
+        with open(self.filename, "wb") as f:
+            f.write(b"not a sample set file at all")
+        with self.assertRaises(IOError):
+            lsst.meas.modelfit.readSampleSetFile(self.filename)
+
+
+class TestMemory(lsst.utils.tests.MemoryTestCase):
+    pass
+
+
+def setup_module(module):
+    lsst.utils.tests.init()
+
+
+if __name__ == "__main__":
+    lsst.utils.tests.init()
+    unittest.main()
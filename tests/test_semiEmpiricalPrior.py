@@ -62,6 +62,17 @@ class SemiEmpiricalPriorTestCase(lsst.utils.tests.TestCase):
             p = self.prior.evaluate(numpy.array([row["eta1"], row["eta2"], row["lnR"]]), self.amplitudes)
             self.assertFloatsAlmostEqual(row["p"], p)
 
+    def testBatchEvaluate(self):
+        nonlinear = numpy.ascontiguousarray(
+            numpy.vstack([self.data["eta1"], self.data["eta2"], self.data["lnR"]]).transpose()
+        )
+        amplitudes = numpy.ones((nonlinear.shape[0], 1), dtype=lsst.meas.modelfit.Scalar)
+        amplitudes[::5, 0] = -1.0
+        out = numpy.zeros(nonlinear.shape[0], dtype=lsst.meas.modelfit.Scalar)
+        self.prior.evaluate(nonlinear, amplitudes, out)
+        expected = numpy.where(amplitudes[:, 0] < 0.0, 0.0, self.data["p"])
+        self.assertFloatsAlmostEqual(out, expected)
+
     def testGradient(self):
         for row in self.data:
             grad = numpy.zeros(4, dtype=float)
@@ -122,6 +122,23 @@ class SoftenedLinearPriorTestCase(lsst.utils.tests.TestCase):
                 for r in logRadiusPoints:
                     self.checkDerivatives(e1, e2, r)
 
+    def testBatchEvaluate(self):
+        """Test that the batched evaluate() overload agrees with per-row calls
+        to the single-point one, including rows with negative amplitudes.
+        """
+        ctrl = self.prior.getControl()
+        n = 50
+        nonlinear = numpy.zeros((n, 3), dtype=lsst.meas.modelfit.Scalar)
+        nonlinear[:, 0] = numpy.random.uniform(-ctrl.ellipticityMaxOuter, ctrl.ellipticityMaxOuter, n)
+        nonlinear[:, 1] = numpy.random.uniform(-ctrl.ellipticityMaxOuter, ctrl.ellipticityMaxOuter, n)
+        nonlinear[:, 2] = numpy.random.uniform(ctrl.logRadiusMinOuter, ctrl.logRadiusMaxOuter, n)
+        amplitudes = numpy.ones((n, 1), dtype=lsst.meas.modelfit.Scalar)
+        amplitudes[::7, 0] = -1.0
+        out = numpy.zeros(n, dtype=lsst.meas.modelfit.Scalar)
+        self.prior.evaluate(nonlinear, amplitudes, out)
+        expected = numpy.array([self.prior.evaluate(nonlinear[i], amplitudes[i]) for i in range(n)])
+        self.assertFloatsAlmostEqual(out, expected, rtol=1E-15)
+
     @unittest.skipIf(scipy is None, "could not import scipy")
     def testIntegral(self):
         """Test that the prior is properly normalized.
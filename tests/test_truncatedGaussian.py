@@ -31,6 +31,7 @@ except ImportError:
 
 import lsst.utils.logging
 import lsst.utils.tests
+import lsst.afw.math
 import lsst.meas.modelfit
 
 
@@ -188,6 +189,57 @@ class TruncatedGaussianTestCase(lsst.utils.tests.TestCase):
                                          rtol=1E-13)
             self.check2d(mu, hessian, tg, isDegenerate=True)
 
+    def testBuilder(self):
+        builder = lsst.meas.modelfit.TruncatedGaussianBuilder(2)
+        self.assertEqual(builder.getDim(), 2)
+        x = numpy.linspace(-1, 1, 5)
+        model = numpy.zeros((x.size, 2), dtype=float)
+        model[:, 0] = x
+        model[:, 1] = x**2 + x
+        hessian = numpy.dot(model.transpose(), model)
+        # Repeated calls with the same Hessian (the case the builder caches for)
+        # and with different Hessians must both match the one-shot factory exactly.
+        for scale in (1.0, 1.0, 1.0, 2.0, 2.0):
+            data = numpy.random.randn(x.size)
+            q0 = 0.5*float(numpy.dot(data, data))
+            gradient = -numpy.dot(model.transpose(), data)
+            tg1 = builder(q0, gradient, scale*hessian)
+            tg2 = lsst.meas.modelfit.TruncatedGaussian.fromSeriesParameters(q0, gradient,
+                                                                            scale*hessian)
+            self.assertEqual(tg1.getLogPeakAmplitude(), tg2.getLogPeakAmplitude())
+            self.assertEqual(tg1.getLogIntegral(), tg2.getLogIntegral())
+            self.assertEqual(tg1.getUntruncatedFraction(), tg2.getUntruncatedFraction())
+            self.assertFloatsAlmostEqual(tg1.maximize(), tg2.maximize(), rtol=0.0, atol=0.0)
+
+    def testBatchSampling(self):
+        rng = lsst.afw.math.Random(1)
+        mu = numpy.array([1.0, 0.5])
+        sigma = numpy.array([[1.0, 0.2],
+                             [0.2, 0.8]])
+        tg = lsst.meas.modelfit.TruncatedGaussian.fromStandardParameters(mu, sigma)
+        nSamples = 4000
+        for strategy in (lsst.meas.modelfit.TruncatedGaussian.DIRECT_WITH_REJECTION,
+                         lsst.meas.modelfit.TruncatedGaussian.ALIGN_AND_WEIGHT):
+            sampler = tg.sample(strategy)
+            alpha1 = numpy.zeros((nSamples, 2), dtype=lsst.meas.modelfit.Scalar)
+            weights1 = numpy.zeros(nSamples, dtype=lsst.meas.modelfit.Scalar)
+            sampler(rng, alpha1, weights1)
+            self.assertTrue(numpy.all(alpha1 >= 0.0))
+            self.assertTrue(numpy.all(weights1 >= 0.0))
+            self.assertGreater(weights1.sum(), 0.0)
+            # The batched path should agree statistically with row-by-row draws.
+            alpha2 = numpy.zeros((nSamples, 2), dtype=lsst.meas.modelfit.Scalar)
+            weights2 = numpy.zeros(nSamples, dtype=lsst.meas.modelfit.Scalar)
+            for i in range(nSamples):
+                weights2[i] = sampler(rng, alpha2[i])
+            mean1 = numpy.average(alpha1, weights=weights1, axis=0)
+            mean2 = numpy.average(alpha2, weights=weights2, axis=0)
+            self.assertFloatsAlmostEqual(mean1, mean2, atol=0.1)
+            # multiplyWeights should scale the given weights rather than overwrite them.
+            weights3 = numpy.full(nSamples, 2.0, dtype=lsst.meas.modelfit.Scalar)
+            sampler(rng, alpha1, weights3, True)
+            self.assertTrue(numpy.all(weights3 >= 0.0))
+
 
 class TestMemory(lsst.utils.tests.MemoryTestCase):
     pass